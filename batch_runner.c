@@ -0,0 +1,472 @@
+/**
+ * @file batch_runner.c
+ * @brief This file contains the function definitions for running the program in batch mode.
+ *
+ * The file includes the function definitions of a non-interactive mode which reads commands line by line
+ * and runs them against the list of students.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "batch_runner.h"       /* Include header file of this function file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BATCH_LINE_SIZE     1024        /* The maximum number of characters of a command line */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Runs one command of a batch file.
+ *
+ * @param command The name of the command.
+ * @param argument The argument of the command, an empty string if there is none.
+ * @return 1 if the command succeeded, 0 otherwise.
+ */
+static int32_t runBatchCommand(int8_t *command, int8_t *argument);
+
+/**
+ * @brief Checks that the list can be modified by a command.
+ *
+ * This function reports an error if the list is a read-only snapshot.
+ *
+ * @param command The name of the command.
+ * @return 1 if the list can be modified, 0 otherwise.
+ */
+static int32_t checkListWritable(const int8_t *command);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Runs the commands of a batch file.
+ *
+ * This function reads one command per line and runs it. Empty lines and lines starting with '#' are ignored.
+ * The supported commands are:
+ * - add ID,name,account,score      adds a student, validated like a row of a CSV file
+ * - delete ID                      deletes the student having the ID
+ * - purge ID,ID,...                deletes the students having the IDs in one pass, missing IDs are reported
+ * - sort score | sort name         sorts the list
+ * - threads N                      sorts the list on N threads
+ * - search id|name|account VALUE   displays the matching students
+ * - search prefix|substring VALUE  displays the students whose name starts with or contains the value
+ * - search score MIN MAX           displays the students whose average score is in the range
+ * - top K                          displays the K students having the highest average scores
+ * - show [block|table|csv|json]    writes the list in a format, block by default, and reports the throughput
+ * - count [score MIN MAX]         displays the number of students, or of the students in the range of scores
+ * - stats                          displays the mean, lowest, highest, standard deviation and histogram of the scores
+ * - clear                          clears the list
+ * - save PATH | load PATH          saves or loads a snapshot file
+ * - open PATH                      opens a snapshot file read-only
+ * - import PATH                    imports a CSV file
+ * Errors are reported on the standard error with their line number, and a summary with the number of
+ * commands and the elapsed time is reported at the end.
+ *
+ * @param input The file to read the commands from.
+ * @return The number of commands which failed.
+ */
+int32_t runBatchCommands(FILE *input)
+{
+    int8_t line[BATCH_LINE_SIZE];       /* Buffer to store each command line */
+    int8_t *command = NULL;             /* The name of the command */
+    int8_t *argument = NULL;            /* The argument of the command */
+    size_t length = 0;                  /* The number of characters of the line */
+    int32_t is_complete = 0;            /* 1 if the whole line fits in the buffer */
+    int32_t line_number = 0;            /* The number of the current line */
+    int32_t num_commands = 0;           /* The number of commands which have been run */
+    int32_t num_errors = 0;             /* The number of commands which failed */
+    clock_t start = clock();            /* The time when the batch starts */
+
+    /* Read every line of the input */
+    while (fgets(line, BATCH_LINE_SIZE, input) != NULL)
+    {
+        line_number++;
+        length = strlen(line);
+        is_complete = (((length > 0) && (line[length - 1] == '\n')) || feof(input)) ? 1 : 0;
+
+        /* Remove the end of line characters */
+        while ((length > 0) && ((line[length - 1] == '\n') || (line[length - 1] == '\r')))
+        {
+            length--;
+            line[length] = '\0';
+        }
+
+        /* Skip the leading spaces */
+        command = line;
+        while ((*command == ' ') || (*command == '\t'))
+        {
+            command++;
+        }
+
+        /* If the line is too long, skip the rest of it */
+        if (!is_complete)
+        {
+            fprintf(stderr, "line %d: command is longer than %d characters\n", line_number, BATCH_LINE_SIZE - 2);
+            num_errors++;
+            while ((fgets(line, BATCH_LINE_SIZE, input) != NULL) && (strchr(line, '\n') == NULL))
+            {
+                /* Do nothing */
+            }
+        }
+        /* If the line holds a command */
+        else if ((*command != '\0') && (*command != '#'))
+        {
+            /* Split the name of the command from its argument */
+            argument = command;
+            while ((*argument != '\0') && (*argument != ' ') && (*argument != '\t'))
+            {
+                argument++;
+            }
+            if (*argument != '\0')
+            {
+                *argument = '\0';
+                argument++;
+                while ((*argument == ' ') || (*argument == '\t'))
+                {
+                    argument++;
+                }
+            }
+            else
+            {
+                /* Do nothing */
+            }
+
+            num_commands++;
+            /* Run the command */
+            if (!runBatchCommand(command, argument))
+            {
+                fprintf(stderr, "line %d: '%s' failed\n", line_number, command);
+                num_errors++;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    /* Report the summary of the batch */
+    fprintf(stderr, "batch: %d commands, %d errors, %.3f seconds\n",
+            num_commands, num_errors, (double)(clock() - start) / CLOCKS_PER_SEC);
+    /* Return the number of errors */
+    return num_errors;
+}
+
+/**
+ * @brief Runs one command of a batch file.
+ *
+ * @param command The name of the command.
+ * @param argument The argument of the command, an empty string if there is none.
+ * @return 1 if the command succeeded, 0 otherwise.
+ */
+static int32_t runBatchCommand(int8_t *command, int8_t *argument)
+{
+    int32_t is_success = 1;             /* Initialize is_success to 1 */
+    int8_t *value = NULL;               /* The value searched by the search command */
+    float min_score = 0;                /* The lowest average score searched by the search command */
+    float max_score = 0;                /* The highest average score searched by the search command */
+    int8_t **IDs = NULL;                /* The IDs of the purge command */
+    int8_t **missing_IDs = NULL;        /* The IDs of the purge command which are not on the list */
+    int32_t num_IDs = 0;                /* The number of IDs of the purge command */
+    int32_t num_missing = 0;            /* The number of IDs of the purge command which are not on the list */
+    int32_t num_deleted = 0;            /* The number of students deleted by the purge command */
+    int32_t num_skipped = 0;            /* The number of records skipped by the load command */
+    int32_t i = 0;                      /* Initialize temporary variable */
+    CsvImportResult_t import_result;    /* The result of the import command */
+    OutputFormat_t format = OUTPUT_FORMAT_BLOCK;    /* The format of the show command */
+    ListOutputResult_t output_result;   /* The result of the show command */
+    ClassStatistics_t statistics;       /* The result of the stats command */
+
+    if (strcmp(command, "add") == 0)
+    {
+        /* Add the student described like a row of a CSV file */
+        is_success = checkListWritable(command) &&
+                     (importCsvRow(argument, argument + strlen(argument), 0) == CSV_ROW_IMPORTED);
+    }
+    else if (strcmp(command, "delete") == 0)
+    {
+        /* Delete the student if the ID is on the list */
+        is_success = checkListWritable(command) && is_ID_Exist(argument);
+        if (is_success)
+        {
+            deleteStudentInfo(argument);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if (strcmp(command, "purge") == 0)
+    {
+        is_success = checkListWritable(command) && (*argument != '\0');
+        if (is_success)
+        {
+            /* Split the IDs at the commas, there are at most as many IDs as characters */
+            IDs = (int8_t **)malloc((strlen(argument) + 1) * sizeof(int8_t *));
+            missing_IDs = (int8_t **)malloc((strlen(argument) + 1) * sizeof(int8_t *));
+            IDs[num_IDs] = argument;
+            num_IDs++;
+            for (value = argument; *value != '\0'; value++)
+            {
+                if (*value == ',')
+                {
+                    *value = '\0';
+                    IDs[num_IDs] = value + 1;
+                    num_IDs++;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+
+            /* Delete the students and report the IDs which are not on the list */
+            num_deleted = deleteStudentsBatch(IDs, num_IDs, missing_IDs, &num_missing);
+            for (i = 0; i < num_missing; i++)
+            {
+                fprintf(stderr, "purge: ID '%s' is not on the list\n", missing_IDs[i]);
+            }
+            fprintf(stderr, "purge: %d deleted, %d not found\n", num_deleted, num_missing);
+            free(IDs);
+            free(missing_IDs);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if (strcmp(command, "sort") == 0)
+    {
+        is_success = checkListWritable(command);
+        if (is_success && (strcmp(argument, "score") == 0))
+        {
+            sortByScore();
+        }
+        else if (is_success && (strcmp(argument, "name") == 0))
+        {
+            sortByName();
+        }
+        else
+        {
+            is_success = 0;
+        }
+    }
+    else if (strcmp(command, "threads") == 0)
+    {
+        /* Set the number of threads of the sorts */
+        is_success = (atoi(argument) > 0) ? 1 : 0;
+        if (is_success)
+        {
+            setSortThreads(atoi(argument));
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if (strcmp(command, "search") == 0)
+    {
+        /* Split the field from the value */
+        value = argument;
+        while ((*value != '\0') && (*value != ' '))
+        {
+            value++;
+        }
+        if (*value != '\0')
+        {
+            *value = '\0';
+            value++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        /* Display the matching students, a missing student is not an error */
+        if (strcmp(argument, "id") == 0)
+        {
+            searchInfoByID(value);
+        }
+        else if (strcmp(argument, "name") == 0)
+        {
+            searchInfoByName(value);
+        }
+        else if (strcmp(argument, "account") == 0)
+        {
+            searchInfoByAcc(value);
+        }
+        else if (strcmp(argument, "prefix") == 0)
+        {
+            searchInfoByNamePattern(value, NAME_MATCH_PREFIX);
+        }
+        else if (strcmp(argument, "substring") == 0)
+        {
+            searchInfoByNamePattern(value, NAME_MATCH_SUBSTRING);
+        }
+        else if ((strcmp(argument, "score") == 0) &&
+                 (sscanf((char *)value, "%f %f", &min_score, &max_score) == 2) && (min_score <= max_score))
+        {
+            searchInfoByScoreRange(min_score, max_score);
+        }
+        else
+        {
+            is_success = 0;
+        }
+    }
+    else if (strcmp(command, "top") == 0)
+    {
+        /* Display the students having the highest average scores */
+        is_success = (atoi(argument) > 0) ? 1 : 0;
+        if (is_success)
+        {
+            showTopStudentsByScore(atoi(argument));
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if (strcmp(command, "show") == 0)
+    {
+        /* Write the list in the format of the argument */
+        is_success = 1;
+        if ((argument[0] == '\0') || (strcmp(argument, "block") == 0))
+        {
+            format = OUTPUT_FORMAT_BLOCK;
+        }
+        else if (strcmp(argument, "table") == 0)
+        {
+            format = OUTPUT_FORMAT_TABLE;
+        }
+        else if (strcmp(argument, "csv") == 0)
+        {
+            format = OUTPUT_FORMAT_CSV;
+        }
+        else if (strcmp(argument, "json") == 0)
+        {
+            format = OUTPUT_FORMAT_JSON;
+        }
+        else
+        {
+            is_success = 0;
+        }
+        if (is_success)
+        {
+            is_success = writeListStudents(stdout, format, &output_result);
+            fprintf(stderr, "show: %d students, %llu bytes, %.1f MB per second\n", output_result.num_students,
+                    (unsigned long long)output_result.num_bytes, output_result.megabytes_per_second);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if (strcmp(command, "count") == 0)
+    {
+        /* Count the list, or the students of a range of average scores */
+        if (argument[0] == '\0')
+        {
+            printf("%d\n", getListSize());
+        }
+        else if ((strncmp(argument, "score ", 6) == 0) &&
+                 (sscanf((char *)argument + 6, "%f %f", &min_score, &max_score) == 2) && (min_score <= max_score))
+        {
+            printf("%d\n", countStudentsByScoreRange(min_score, max_score));
+        }
+        else
+        {
+            is_success = 0;
+        }
+    }
+    else if (strcmp(command, "stats") == 0)
+    {
+        /* Display the statistics of the average scores, then one line per band of the histogram */
+        computeClassStatistics(&statistics);
+        printf("%d students, mean %.2f, min %.2f, max %.2f, standard deviation %.2f\n", statistics.num_students,
+               statistics.mean, statistics.min_score, statistics.max_score, statistics.std_dev);
+        for (i = 0; i < CLASS_STATS_BANDS; i++)
+        {
+            printf("[%d, %d%s %u\n", i, i + 1, (i < (CLASS_STATS_BANDS - 1)) ? "):" : "]:", statistics.bands[i]);
+        }
+    }
+    else if (strcmp(command, "clear") == 0)
+    {
+        clearList();
+    }
+    else if (strcmp(command, "save") == 0)
+    {
+        is_success = saveListToFile((char *)argument);
+    }
+    else if (strcmp(command, "load") == 0)
+    {
+        is_success = loadListFromFile((char *)argument, &num_skipped);
+        if (is_success && (num_skipped > 0))
+        {
+            fprintf(stderr, "load: %d records with an empty or duplicated ID or account skipped\n", num_skipped);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if (strcmp(command, "open") == 0)
+    {
+        is_success = openListSnapshot((char *)argument);
+    }
+    else if (strcmp(command, "import") == 0)
+    {
+        is_success = importStudentsFromCsv((char *)argument, &import_result);
+        if (is_success)
+        {
+            fprintf(stderr, "import: %d imported, %d rejected, %.0f rows per second\n",
+                    import_result.num_imported, import_result.num_rejected, import_result.rows_per_second);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* The command is unknown */
+        is_success = 0;
+    }
+    /* Return the value of is_success */
+    return is_success;
+}
+
+/**
+ * @brief Checks that the list can be modified by a command.
+ *
+ * This function reports an error if the list is a read-only snapshot.
+ *
+ * @param command The name of the command.
+ * @return 1 if the list can be modified, 0 otherwise.
+ */
+static int32_t checkListWritable(const int8_t *command)
+{
+    int32_t is_writable = 1;        /* Initialize is_writable to 1 */
+
+    /* A read-only snapshot cannot be modified */
+    if (is_List_ReadOnly())
+    {
+        fprintf(stderr, "%s: the list is opened read-only from a snapshot\n", command);
+        is_writable = 0;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the value of is_writable */
+    return is_writable;
+} /* EOF */
@@ -0,0 +1,62 @@
+/**
+ * @file batch_runner.h
+ * @brief This file contains the function prototypes for running the program in batch mode.
+ *
+ * This file contains the function prototypes of a non-interactive mode which reads commands line by line
+ * from a file or the standard input and runs them against the list of students, without clearing the console
+ * or waiting for a key.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdio.h>              /* Include standard input and output library for printf, fgets, ... */
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For atoi() function */
+#include <string.h>             /* For strcmp(), strchr(), strlen() functions */
+#include <time.h>               /* For clock() function */
+#include "manage_students.h"    /* Include header file for managing students' information by using linked list */
+#include "csv_import.h"         /* Include header file for the importCsvRow function */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Runs the commands of a batch file.
+ *
+ * This function reads one command per line and runs it. Empty lines and lines starting with '#' are ignored.
+ * The supported commands are:
+ * - add ID,name,account,score      adds a student, validated like a row of a CSV file
+ * - delete ID                      deletes the student having the ID
+ * - purge ID,ID,...                deletes the students having the IDs in one pass, missing IDs are reported
+ * - sort score | sort name         sorts the list
+ * - threads N                      sorts the list on N threads
+ * - search id|name|account VALUE   displays the matching students
+ * - search prefix|substring VALUE  displays the students whose name starts with or contains the value
+ * - search score MIN MAX           displays the students whose average score is in the range
+ * - top K                          displays the K students having the highest average scores
+ * - show [block|table|csv|json]    writes the list in a format, block by default, and reports the throughput
+ * - count [score MIN MAX]         displays the number of students, or of the students in the range of scores
+ * - stats                          displays the mean, lowest, highest, standard deviation and histogram of the scores
+ * - clear                          clears the list
+ * - save PATH | load PATH          saves or loads a snapshot file
+ * - open PATH                      opens a snapshot file read-only
+ * - import PATH                    imports a CSV file
+ * Errors are reported on the standard error with their line number, and a summary with the number of
+ * commands and the elapsed time is reported at the end.
+ *
+ * @param input The file to read the commands from.
+ * @return The number of commands which failed.
+ */
+int32_t runBatchCommands(FILE *input);
+
+#endif /* BATCH_RUNNER_H */
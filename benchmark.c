@@ -0,0 +1,1485 @@
+/**
+ * @file benchmark.c
+ * @brief This file contains the benchmark program of the functions for managing students' information.
+ *
+ * This file contains a separate program which generates synthetic lists of students and measures the time
+ * spent by the functions of manage_students.c. For each size of the list it reports the number of
+ * nanoseconds per operation, the throughput and the peak resident memory of the process, as JSON lines
+ * or CSV rows, so the results of two versions of the program can be compared.
+ * The students are generated from their number, so a run with the same seed always gives the same lists.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdio.h>              /* Include standard input and output library for printf, fprintf, ... */
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For malloc(), free(), strtoul() functions */
+#include <string.h>             /* For strcmp(), strchr(), memset() functions */
+#include <math.h>               /* For sqrt() function */
+#include "manage_students.h"    /* Include header file for managing students' information by using linked list */
+#include "list_sort.h"          /* Include header file for the LIST_SORT_MAX_THREADS definition */
+#include "score_stats.h"        /* Include header file for the getScoreStatsKernel() function */
+#include "ingest_queue.h"       /* Include header file for the submitStudentRecord() function */
+#ifdef _WIN32
+#include <windows.h>            /* For QueryPerformanceCounter(), CreateThread() functions */
+#include <psapi.h>              /* For GetProcessMemoryInfo() function */
+#include <io.h>                 /* For _dup() function */
+#else
+#include <time.h>               /* For clock_gettime() function */
+#include <unistd.h>             /* For dup() function */
+#include <sys/resource.h>       /* For getrusage() function */
+#include <pthread.h>            /* For pthread_create(), pthread_join() functions */
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_MIN_STUDENTS      1000u           /* The default number of students of the smallest list */
+#define BENCH_MAX_STUDENTS      1000000u        /* The default number of students of the largest list */
+#define BENCH_LIMIT_STUDENTS    10000000u       /* The largest number of students accepted on the command line */
+#define BENCH_BATCH_SIZE        4096u           /* The number of students generated before each timed batch */
+#define BENCH_MAX_QUERIES       1000000u        /* The maximum number of lookups by ID of each benchmark */
+#define BENCH_SCAN_BUDGET       50000000u       /* The number of visited students allowed to the operations walking the list */
+#define BENCH_NAME_SIZE         64              /* The size of a generated name, including the null terminator */
+#define BENCH_NAME_PARTS        16u             /* The number of choices for each part of a generated name */
+#define BENCH_SCORE_RANGE       0.05f           /* The width of the ranges of average scores which are searched */
+#define BENCH_COUNT_RANGE       2.0f            /* The width of the ranges of average scores which are counted */
+#define BENCH_TOP_STUDENTS      100             /* The number of students displayed by showTopStudentsByScore */
+#define BENCH_MAX_READERS       16u             /* The largest number of threads of the concurrent lookups */
+#define BENCH_MAX_PRODUCERS     16u             /* The largest number of threads adding students at the same time */
+#ifdef _WIN32
+#define BENCH_NULL_DEVICE       "NUL"           /* The device receiving the output of the benchmarked functions */
+#else
+#define BENCH_NULL_DEVICE       "/dev/null"     /* The device receiving the output of the benchmarked functions */
+#endif
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @enum BenchFormat
+ * @brief This enumeration lists the formats of the report.
+ */
+typedef enum BenchFormat
+{
+    BENCH_FORMAT_JSON = 0,      /* One JSON object per line */
+    BENCH_FORMAT_CSV            /* One CSV row per line, after a header row */
+} BenchFormat_t;
+
+/**
+ * @struct BenchRecord
+ * @brief This structure represents the information of a generated student.
+ */
+typedef struct BenchRecord
+{
+    int8_t ID[STUDENT_KEY_SIZE];        /* The ID of the student */
+    int8_t name[BENCH_NAME_SIZE];       /* The name of the student */
+    int8_t account[STUDENT_KEY_SIZE];   /* The account of the student */
+    float average_score;                /* The average score of the student */
+} BenchRecord_t;
+
+/**
+ * @brief Pointer to a function which runs one benchmarked operation on a generated student.
+ */
+typedef void (*BenchOperation_t)(BenchRecord_t *record);
+
+/**
+ * @struct BenchReader
+ * @brief This structure represents the work of a thread of the concurrent lookups.
+ */
+typedef struct BenchReader
+{
+    BenchRecord_t *records;             /* The generated students which are looked up */
+    uint32_t num_records;               /* The number of generated students */
+    uint32_t first;                     /* The position of the first student looked up by the thread */
+    uint32_t num_lookups;               /* The number of lookups of the thread */
+} BenchReader_t;
+
+/**
+ * @struct BenchProducer
+ * @brief This structure represents the work of a thread adding students at the same time as other threads.
+ */
+typedef struct BenchProducer
+{
+    const uint32_t *numbers;            /* The numbers of the students generated by the thread */
+    uint32_t num_students;              /* The number of students generated by the thread */
+    int32_t is_queued;                  /* 1 to submit the students to the queue, 0 to add them one by one */
+} BenchProducer_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Runs every benchmark on a list of students.
+ *
+ * @param num_students The number of students of the list.
+ */
+static void runBenchmarks(uint32_t num_students);
+
+/**
+ * @brief Times an operation on generated students.
+ *
+ * @param operation The function which runs the operation on one student.
+ * @param order The numbers of the students of the list, in random order.
+ * @param num_students The number of students of the list.
+ * @param num_ops The number of operations to run.
+ * @param is_distinct 1 to take the students in the order of the list of numbers, 0 to pick them at random.
+ * @return The time spent by the operations, in nanoseconds.
+ */
+static uint64_t timeOperation(BenchOperation_t operation, const uint32_t *order, uint32_t num_students,
+                              uint32_t num_ops, int32_t is_distinct);
+
+/**
+ * @brief Generates the information of a student from its number.
+ *
+ * @param number The number of the student.
+ * @param record Pointer to a structure which receives the information of the student.
+ */
+static void makeRecord(uint32_t number, BenchRecord_t *record);
+
+/**
+ * @brief Reports the result of a benchmark.
+ *
+ * @param benchmark The name of the benchmark.
+ * @param num_students The number of students of the list.
+ * @param num_ops The number of operations which have been timed.
+ * @param num_items The number of students processed by the operations.
+ * @param elapsed_ns The time spent by the operations, in nanoseconds.
+ */
+static void reportResult(const char *benchmark, uint32_t num_students, uint32_t num_ops,
+                         uint64_t num_items, uint64_t elapsed_ns);
+
+/**
+ * @brief Gets a random number.
+ *
+ * @return A pseudo-random number of 32 bits.
+ */
+static uint32_t nextRandom(void);
+
+/**
+ * @brief Gets the current time.
+ *
+ * @return The time of a monotonic clock, in nanoseconds.
+ */
+static uint64_t getTimeNs(void);
+
+/**
+ * @brief Gets the peak resident memory of the process.
+ *
+ * @return The largest resident memory of the process so far, in kilobytes.
+ */
+static uint64_t getPeakRssKb(void);
+
+/**
+ * @brief Compares two students by their average score in descending order, like sortByScore orders them.
+ *
+ * @param first The first student.
+ * @param second The second student.
+ * @return A negative value if first has a higher average score, a positive value if it has a lower one, 0 otherwise.
+ */
+static int32_t compareScores(const Student_t *first, const Student_t *second);
+
+/**
+ * @brief Compares two students by their name in ascending order, like sortByName orders them.
+ *
+ * @param first The first student.
+ * @param second The second student.
+ * @return The result of strcmp on the names of the two students.
+ */
+static int32_t compareNames(const Student_t *first, const Student_t *second);
+
+/**
+ * @brief Computes the statistics of the average scores by walking the list, like before computeClassStatistics.
+ *
+ * @param statistics Pointer to a structure which receives the statistics.
+ */
+static void walkClassStatistics(ClassStatistics_t *statistics);
+
+/**
+ * @brief Times lookups by ID run by several threads at the same time.
+ *
+ * @param records The generated students which are looked up.
+ * @param num_records The number of generated students.
+ * @param num_readers The number of threads of the lookups, between 1 and BENCH_MAX_READERS.
+ * @param num_lookups The number of lookups shared by the threads.
+ * @param num_sorts Pointer to a variable which receives the number of sorts of a thread changing the list
+ *                  during the lookups, NULL to run the lookups alone.
+ * @return The time spent until every lookup is done, in nanoseconds.
+ */
+static uint64_t timeConcurrentLookups(BenchRecord_t *records, uint32_t num_records, uint32_t num_readers,
+                                      uint32_t num_lookups, uint32_t *num_sorts);
+
+/**
+ * @brief Runs the lookups of a thread of the concurrent lookups.
+ *
+ * @param reader The work of the thread.
+ */
+static void runReader(const BenchReader_t *reader);
+
+/**
+ * @brief Sorts the list by score and by name in turn until every thread of the concurrent lookups is done.
+ *
+ * @param num_sorts Pointer to a variable which receives the number of sorts.
+ */
+static void runWriter(uint32_t *num_sorts);
+
+/**
+ * @brief Times the building of a list by several threads adding students at the same time.
+ *
+ * @param order The numbers of the students of the list, in random order.
+ * @param num_students The number of students of the list.
+ * @param num_producers The number of threads, between 1 and BENCH_MAX_PRODUCERS.
+ * @param is_queued 1 to submit the students with submitStudentRecord, 0 to add them with addStudentInfoToList.
+ * @return The time spent until every student is on the list, in nanoseconds.
+ */
+static uint64_t timeProducers(const uint32_t *order, uint32_t num_students, uint32_t num_producers,
+                              int32_t is_queued);
+
+/**
+ * @brief Generates the students of a thread adding students at the same time as other threads, and adds them.
+ *
+ * @param producer The work of the thread.
+ */
+static void runProducer(const BenchProducer_t *producer);
+
+#ifdef _WIN32
+/**
+ * @brief Runs the lookups of a thread of the concurrent lookups.
+ *
+ * @param arg The work of the thread.
+ * @return Always 0.
+ */
+static DWORD WINAPI readerThreadMain(LPVOID arg);
+
+/**
+ * @brief Sorts the list by score and by name in turn until every thread of the concurrent lookups is done.
+ *
+ * @param arg Pointer to a variable which receives the number of sorts.
+ * @return Always 0.
+ */
+static DWORD WINAPI writerThreadMain(LPVOID arg);
+
+/**
+ * @brief Runs a thread adding students at the same time as other threads.
+ *
+ * @param arg The work of the thread.
+ * @return Always 0.
+ */
+static DWORD WINAPI producerThreadMain(LPVOID arg);
+#else
+/**
+ * @brief Runs the lookups of a thread of the concurrent lookups.
+ *
+ * @param arg The work of the thread.
+ * @return Always NULL.
+ */
+static void *readerThreadMain(void *arg);
+
+/**
+ * @brief Sorts the list by score and by name in turn until every thread of the concurrent lookups is done.
+ *
+ * @param arg Pointer to a variable which receives the number of sorts.
+ * @return Always NULL.
+ */
+static void *writerThreadMain(void *arg);
+
+/**
+ * @brief Runs a thread adding students at the same time as other threads.
+ *
+ * @param arg The work of the thread.
+ * @return Always NULL.
+ */
+static void *producerThreadMain(void *arg);
+#endif
+
+/* The benchmarked operations */
+static void runIdExist(BenchRecord_t *record);
+static void runCheckConflicts(BenchRecord_t *record);
+static void runSearchByID(BenchRecord_t *record);
+static void runSearchByName(BenchRecord_t *record);
+static void runSearchByAcc(BenchRecord_t *record);
+static void runFindByName(BenchRecord_t *record);
+static void runFindByAccount(BenchRecord_t *record);
+static void runSearchByNamePrefix(BenchRecord_t *record);
+static void runSearchByNameSubstring(BenchRecord_t *record);
+static void runSearchByScoreRange(BenchRecord_t *record);
+static void runCountByScoreRange(BenchRecord_t *record);
+static void runShowTopStudents(BenchRecord_t *record);
+static void runDelete(BenchRecord_t *record);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint64_t random_state = 0x9E3779B97F4A7C15u;     /* The state of the random number generator */
+static FILE *report = NULL;                             /* The stream receiving the report */
+static BenchFormat_t format = BENCH_FORMAT_JSON;        /* The format of the report */
+static uint32_t max_threads = 1;                        /* The largest number of threads of the sorts */
+static int32_t num_readers_left = 0;                    /* The number of threads of the concurrent lookups still running */
+extern StudentList_t student_list;                      /* The descriptor of the list, defined in manage_students.c */
+
+static const char *const family_names[BENCH_NAME_PARTS] =
+{
+    "Nguyen", "Tran", "Le", "Pham", "Hoang", "Huynh", "Phan", "Vu",
+    "Vo", "Dang", "Bui", "Do", "Ho", "Ngo", "Duong", "Ly"
+};
+static const char *const middle_names[BENCH_NAME_PARTS] =
+{
+    "Van", "Thi", "Duc", "Minh", "Ngoc", "Thanh", "Quoc", "Huu",
+    "Thu", "Gia", "Bao", "Kim", "Xuan", "Hong", "Dinh", "Anh"
+};
+static const char *const given_names[BENCH_NAME_PARTS] =
+{
+    "An", "Binh", "Chi", "Dung", "Giang", "Ha", "Hai", "Hung",
+    "Khanh", "Lan", "Linh", "Long", "Mai", "Nam", "Phuong", "Tuan"
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief The main function of the benchmark program.
+ *
+ * This function reads the options of the benchmark, then runs every benchmark on lists whose sizes grow
+ * ten times from the smallest size to the largest size. The options are:
+ * - --min N          the number of students of the smallest list (default 1000)
+ * - --max N          the number of students of the largest list (default 1000000, at most 10000000)
+ * - --seed N         the seed of the random number generator
+ * - --threads N      the largest number of threads of the sorts (default 1), the sorts are timed on
+ *                    1, 2, 4, ... threads up to N
+ * - --storage S      list (default) or columnar, the storage of the list, see setColumnarStorage
+ * - --format F       json (default) or csv
+ * - --output PATH    the file receiving the report (default the standard output)
+ * The output of the benchmarked functions is sent to the null device.
+ *
+ * @param argc The number of arguments of the program.
+ * @param argv The arguments of the program.
+ * @return 0 if the benchmarks have been run, 1 if an option is not valid.
+ */
+int main(int argc, char *argv[])
+{
+    int32_t exit_code = 0;                  /* Initialize variable to store the exit code of the program */
+    uint32_t min_students = BENCH_MIN_STUDENTS;     /* The number of students of the smallest list */
+    uint32_t max_students = BENCH_MAX_STUDENTS;     /* The number of students of the largest list */
+    const char *output = NULL;              /* The path of the file receiving the report */
+    uint64_t num_students = 0;              /* The number of students of the current list */
+    int32_t i = 0;                          /* Initialize temporary variable */
+
+    /* Read the options */
+    for (i = 1; (i < argc) && (exit_code == 0); i += 2)
+    {
+        if (i + 1 >= argc)
+        {
+            exit_code = 1;
+        }
+        else if (strcmp(argv[i], "--min") == 0)
+        {
+            min_students = (uint32_t)strtoul(argv[i + 1], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--max") == 0)
+        {
+            max_students = (uint32_t)strtoul(argv[i + 1], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--threads") == 0)
+        {
+            max_threads = (uint32_t)strtoul(argv[i + 1], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--seed") == 0)
+        {
+            /* The state of the generator must not be 0 */
+            random_state ^= (uint64_t)strtoul(argv[i + 1], NULL, 10);
+            random_state = (random_state == 0) ? 1 : random_state;
+        }
+        else if ((strcmp(argv[i], "--storage") == 0) && (strcmp(argv[i + 1], "list") == 0))
+        {
+            setColumnarStorage(0);
+        }
+        else if ((strcmp(argv[i], "--storage") == 0) && (strcmp(argv[i + 1], "columnar") == 0))
+        {
+            setColumnarStorage(1);
+        }
+        else if ((strcmp(argv[i], "--format") == 0) && (strcmp(argv[i + 1], "json") == 0))
+        {
+            format = BENCH_FORMAT_JSON;
+        }
+        else if ((strcmp(argv[i], "--format") == 0) && (strcmp(argv[i + 1], "csv") == 0))
+        {
+            format = BENCH_FORMAT_CSV;
+        }
+        else if (strcmp(argv[i], "--output") == 0)
+        {
+            output = argv[i + 1];
+        }
+        else
+        {
+            exit_code = 1;
+        }
+    }
+    if ((min_students == 0) || (max_students < min_students) || (max_students > BENCH_LIMIT_STUDENTS) ||
+        (max_threads == 0) || (max_threads > LIST_SORT_MAX_THREADS))
+    {
+        exit_code = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Open the report before the standard output is sent to the null device */
+    if (exit_code == 0)
+    {
+        if (output != NULL)
+        {
+            report = fopen(output, "w");
+        }
+        else
+        {
+#ifdef _WIN32
+            report = _fdopen(_dup(_fileno(stdout)), "w");
+#else
+            report = fdopen(dup(fileno(stdout)), "w");
+#endif
+        }
+    }
+    else
+    {
+        fprintf(stderr, "usage: %s [--min N] [--max N] [--seed N] [--threads N] [--storage list|columnar] [--format json|csv] [--output PATH]\n", argv[0]);
+    }
+
+    if ((exit_code == 0) && (report == NULL))
+    {
+        fprintf(stderr, "Cannot open the report\n");
+        exit_code = 1;
+    }
+    else if (exit_code == 0)
+    {
+        fflush(stdout);
+        freopen(BENCH_NULL_DEVICE, "w", stdout);
+        if (format == BENCH_FORMAT_CSV)
+        {
+            fprintf(report, "benchmark,students,ops,ns_per_op,ops_per_second,items_per_second,peak_rss_kb\n");
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        /* Run the benchmarks on lists ten times larger each time */
+        for (num_students = min_students; num_students <= max_students; num_students *= 10)
+        {
+            runBenchmarks((uint32_t)num_students);
+        }
+        fclose(report);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the exit code of the program */
+    return exit_code;
+}
+
+/**
+ * @brief Runs every benchmark on a list of students.
+ *
+ * This function builds a list of students in random order of their IDs, timing createStudentInfo and
+ * addStudentInfoToList separately. It then times the lookups by ID, the searches, the sorts and finally
+ * the deletion of students chosen at random, and clears the list.
+ * The same list is then built again batch by batch with addStudentsBatch and cleared.
+ * The operations which walk the whole list are repeated fewer times on larger lists.
+ *
+ * @param num_students The number of students of the list.
+ */
+static void runBenchmarks(uint32_t num_students)
+{
+    uint32_t *order = (uint32_t *)malloc(num_students * sizeof(uint32_t));  /* The numbers of the students in random order */
+    BenchRecord_t *records = (BenchRecord_t *)malloc(BENCH_BATCH_SIZE * sizeof(BenchRecord_t)); /* The generated students of a batch */
+    Student_t **nodes = (Student_t **)malloc(BENCH_BATCH_SIZE * sizeof(Student_t *));   /* The created students of a batch */
+    uint32_t num_queries = (num_students < BENCH_MAX_QUERIES) ? num_students : BENCH_MAX_QUERIES;  /* The number of lookups */
+    uint32_t num_scans = BENCH_SCAN_BUDGET / num_students;      /* The number of operations walking the list */
+    uint32_t batch_size = 0;            /* The number of students of the current batch */
+    uint32_t i = 0;                     /* Initialize temporary variable */
+    uint32_t j = 0;                     /* Initialize temporary variable */
+    uint32_t swap = 0;                  /* Temporary variable to shuffle the numbers */
+    uint64_t start = 0;                 /* The time when the timed operations start */
+    uint64_t create_ns = 0;             /* The time spent by createStudentInfo */
+    uint64_t add_ns = 0;                /* The time spent by addStudentInfoToList */
+    uint64_t elapsed_ns = 0;            /* The time spent by the concurrent lookups */
+    uint32_t num_sorts = 0;             /* The number of sorts during the concurrent lookups */
+    BenchRecord_t *batch_records = NULL;    /* The generated students deleted by deleteStudentsBatch */
+    int8_t **batch_IDs = NULL;          /* The IDs of the students deleted by deleteStudentsBatch */
+    uint32_t num_batch = 0;             /* The number of students deleted by deleteStudentsBatch */
+    int32_t num_missing = 0;            /* The number of IDs which deleteStudentsBatch does not find */
+    StudentRecord_t *batch = (StudentRecord_t *)malloc(BENCH_BATCH_SIZE * sizeof(StudentRecord_t));  /* The records given to addStudentsBatch */
+    int32_t num_rejected = 0;           /* The number of records which addStudentsBatch rejects */
+    uint32_t num_threads = 0;           /* The number of threads of the timed sorts */
+    char name[BENCH_NAME_SIZE];         /* The name of the benchmark of a sort */
+    static const char *format_names[] = {"block", "table", "csv", "json"};    /* The names of the output formats */
+    ListOutputResult_t output_result;   /* The result of writeListStudents */
+    ClassStatistics_t statistics;       /* The result of computeClassStatistics */
+    int32_t format = 0;                 /* Each output format */
+
+    /* Walk the list at least once, and not more often than the number of lookups */
+    num_scans = (num_scans == 0) ? 1 : ((num_scans > num_queries) ? num_queries : num_scans);
+
+    /* Shuffle the numbers of the students */
+    for (i = 0; i < num_students; i++)
+    {
+        order[i] = i;
+    }
+    for (i = num_students - 1; i > 0; i--)
+    {
+        j = nextRandom() % (i + 1);
+        swap = order[i];
+        order[i] = order[j];
+        order[j] = swap;
+    }
+
+    /* Build the list batch by batch, the students are generated outside of the timed loops */
+    for (i = 0; i < num_students; i += batch_size)
+    {
+        batch_size = ((num_students - i) < BENCH_BATCH_SIZE) ? (num_students - i) : BENCH_BATCH_SIZE;
+        for (j = 0; j < batch_size; j++)
+        {
+            makeRecord(order[i + j], &records[j]);
+        }
+
+        start = getTimeNs();
+        for (j = 0; j < batch_size; j++)
+        {
+            nodes[j] = createStudentInfo(records[j].ID, records[j].name, records[j].account, records[j].average_score);
+        }
+        create_ns += getTimeNs() - start;
+
+        start = getTimeNs();
+        for (j = 0; j < batch_size; j++)
+        {
+            addStudentInfoToList(nodes[j]);
+        }
+        add_ns += getTimeNs() - start;
+    }
+    reportResult("createStudentInfo", num_students, num_students, num_students, create_ns);
+    reportResult("addStudentInfoToList", num_students, num_students, num_students, add_ns);
+
+    /* Time the lookups and the searches */
+    reportResult("is_ID_Exist", num_students, num_queries, num_queries,
+                 timeOperation(runIdExist, order, num_students, num_queries, 0));
+    reportResult("checkStudentConflicts", num_students, num_queries, num_queries,
+                 timeOperation(runCheckConflicts, order, num_students, num_queries, 0));
+    reportResult("searchInfoByID", num_students, num_queries, num_queries,
+                 timeOperation(runSearchByID, order, num_students, num_queries, 0));
+    reportResult("searchInfoByName", num_students, num_scans, num_scans,
+                 timeOperation(runSearchByName, order, num_students, num_scans, 0));
+    reportResult("searchInfoByAcc", num_students, num_queries, num_queries,
+                 timeOperation(runSearchByAcc, order, num_students, num_queries, 0));
+    reportResult("findStudentsByAccount", num_students, num_queries, num_queries,
+                 timeOperation(runFindByAccount, order, num_students, num_queries, 0));
+    reportResult("searchInfoByNamePrefix", num_students, num_scans, num_scans,
+                 timeOperation(runSearchByNamePrefix, order, num_students, num_scans, 0));
+    reportResult("searchInfoByNameSubstring", num_students, num_scans, num_scans,
+                 timeOperation(runSearchByNameSubstring, order, num_students, num_scans, 0));
+    reportResult("searchInfoByScoreRange", num_students, num_scans, num_scans,
+                 timeOperation(runSearchByScoreRange, order, num_students, num_scans, 0));
+    reportResult("countStudentsByScoreRange", num_students, num_scans, (uint64_t)num_scans * num_students,
+                 timeOperation(runCountByScoreRange, order, num_students, num_scans, 0));
+    reportResult("showTopStudentsByScore", num_students, num_scans, (uint64_t)num_scans * BENCH_TOP_STUDENTS,
+                 timeOperation(runShowTopStudents, order, num_students, num_scans, 0));
+
+    /* Time the scans for a name on 1, 2, 4, ... threads, the first scan on several threads
+       fills the array of the positions of the list storage */
+    num_threads = 1;
+    while (num_threads <= max_threads)
+    {
+        setSearchThreads((int32_t)num_threads);
+        snprintf(name, sizeof(name), (num_threads == 1) ? "findStudentsByName" : "findStudentsByName_%uthreads", num_threads);
+        reportResult(name, num_students, num_scans, (uint64_t)num_scans * num_students,
+                     timeOperation(runFindByName, order, num_students, num_scans, 0));
+
+        /* Double the number of threads, the last scans run on max_threads threads */
+        if ((num_threads < max_threads) && ((num_threads * 2) > max_threads))
+        {
+            num_threads = max_threads;
+        }
+        else
+        {
+            num_threads *= 2;
+        }
+    }
+    setSearchThreads(1);
+
+    /* Time the statistics of the average scores, from the vector kernel and from a walk of the list */
+    start = getTimeNs();
+    for (i = 0; i < num_scans; i++)
+    {
+        computeClassStatistics(&statistics);
+    }
+    snprintf(name, sizeof(name), "computeClassStatistics_%s", getScoreStatsKernel());
+    reportResult(name, num_students, num_scans, (uint64_t)num_scans * num_students, getTimeNs() - start);
+    start = getTimeNs();
+    for (i = 0; i < num_scans; i++)
+    {
+        walkClassStatistics(&statistics);
+    }
+    reportResult("walkClassStatistics", num_students, num_scans, (uint64_t)num_scans * num_students,
+                 getTimeNs() - start);
+
+    /* Time the buffered writes of the list to the null device in every format */
+    for (format = OUTPUT_FORMAT_BLOCK; format <= OUTPUT_FORMAT_JSON; format++)
+    {
+        start = getTimeNs();
+        writeListStudents(stdout, (OutputFormat_t)format, &output_result);
+        snprintf(name, sizeof(name), "writeListStudents_%s", format_names[format]);
+        reportResult(name, num_students, 1, num_students, getTimeNs() - start);
+    }
+
+    /* Time the radix sort of the scores */
+    start = getTimeNs();
+    sortByScore();
+    reportResult("sortByScore", num_students, 1, num_students, getTimeNs() - start);
+
+    /* Time the sort by name, which fills the sorted view of the names, then both sorts of the unchanged list
+       which relink the students from their sorted views */
+    start = getTimeNs();
+    sortByName();
+    reportResult("sortByName", num_students, 1, num_students, getTimeNs() - start);
+    start = getTimeNs();
+    sortByScore();
+    reportResult("sortByScore_cached", num_students, 1, num_students, getTimeNs() - start);
+    start = getTimeNs();
+    sortByName();
+    reportResult("sortByName_cached", num_students, 1, num_students, getTimeNs() - start);
+
+    /* Time the merge sorts on 1, 2, 4, ... threads, each sort starts from the order of the other one */
+    num_threads = 1;
+    while (num_threads <= max_threads)
+    {
+        setSortThreads((int32_t)num_threads);
+        start = getTimeNs();
+        sortList(compareScores);
+        snprintf(name, sizeof(name), (num_threads == 1) ? "sortListByScore" : "sortListByScore_%uthreads", num_threads);
+        reportResult(name, num_students, 1, num_students, getTimeNs() - start);
+        start = getTimeNs();
+        sortList(compareNames);
+        snprintf(name, sizeof(name), (num_threads == 1) ? "sortListByName" : "sortListByName_%uthreads", num_threads);
+        reportResult(name, num_students, 1, num_students, getTimeNs() - start);
+
+        /* Double the number of threads, the last sorts run on max_threads threads */
+        if ((num_threads < max_threads) && ((num_threads * 2) > max_threads))
+        {
+            num_threads = max_threads;
+        }
+        else
+        {
+            num_threads *= 2;
+        }
+    }
+    setSortThreads(1);
+
+    /* Time the lookups by ID on 1, 4 and 16 threads sharing the lock of the list, alone and while another
+       thread sorts the list again and again */
+    for (i = 0; i < BENCH_BATCH_SIZE; i++)
+    {
+        makeRecord(nextRandom() % num_students, &records[i]);
+    }
+    setConcurrentAccess(1);
+    for (num_threads = 1; num_threads <= BENCH_MAX_READERS; num_threads *= 4)
+    {
+        snprintf(name, sizeof(name), "is_ID_Exist_%ureaders", num_threads);
+        reportResult(name, num_students, num_queries, num_queries,
+                     timeConcurrentLookups(records, BENCH_BATCH_SIZE, num_threads, num_queries, NULL));
+        elapsed_ns = timeConcurrentLookups(records, BENCH_BATCH_SIZE, num_threads, num_queries, &num_sorts);
+        snprintf(name, sizeof(name), "is_ID_Exist_%ureaders_1writer", num_threads);
+        reportResult(name, num_students, num_queries, num_queries, elapsed_ns);
+        snprintf(name, sizeof(name), "sortList_writer_%ureaders", num_threads);
+        reportResult(name, num_students, num_sorts, (uint64_t)num_sorts * num_students, elapsed_ns);
+    }
+    setConcurrentAccess(0);
+
+    /* Time the deletion of distinct students, each one walks the list to find the student before it */
+    reportResult("deleteStudentInfo", num_students, num_scans, (uint64_t)num_scans * num_students,
+                 timeOperation(runDelete, order, num_students, num_scans, 1));
+
+    /* Time the deletion of the next distinct students with one call */
+    num_batch = ((num_students - num_scans) < num_queries) ? (num_students - num_scans) : num_queries;
+    batch_records = (BenchRecord_t *)malloc(((num_batch > 0) ? num_batch : 1) * sizeof(BenchRecord_t));
+    batch_IDs = (int8_t **)malloc(((num_batch > 0) ? num_batch : 1) * sizeof(int8_t *));
+    for (i = 0; i < num_batch; i++)
+    {
+        makeRecord(order[num_scans + i], &batch_records[i]);
+        batch_IDs[i] = batch_records[i].ID;
+    }
+    start = getTimeNs();
+    deleteStudentsBatch(batch_IDs, (int32_t)num_batch, NULL, &num_missing);
+    reportResult("deleteStudentsBatch", num_students, 1, num_batch, getTimeNs() - start);
+    free(batch_records);
+    free(batch_IDs);
+
+    clearList();
+
+    /* Build the list again batch by batch with addStudentsBatch */
+    add_ns = 0;
+    for (i = 0; i < num_students; i += batch_size)
+    {
+        batch_size = ((num_students - i) < BENCH_BATCH_SIZE) ? (num_students - i) : BENCH_BATCH_SIZE;
+        for (j = 0; j < batch_size; j++)
+        {
+            makeRecord(order[i + j], &records[j]);
+            batch[j].ID = records[j].ID;
+            batch[j].name = records[j].name;
+            batch[j].account = records[j].account;
+            batch[j].average_score = records[j].average_score;
+        }
+
+        start = getTimeNs();
+        addStudentsBatch(batch, (int32_t)batch_size, &num_rejected);
+        add_ns += getTimeNs() - start;
+    }
+    reportResult("addStudentsBatch", num_students, (num_students + BENCH_BATCH_SIZE - 1) / BENCH_BATCH_SIZE,
+                 num_students, add_ns);
+    clearList();
+
+    /* Time the building of the list by 1, 4 and 16 threads generating the students, through the queue
+       of submitStudentRecord and one by one with addStudentInfoToList behind the lock of the list */
+    setConcurrentAccess(1);
+    for (num_threads = 1; num_threads <= BENCH_MAX_PRODUCERS; num_threads *= 4)
+    {
+        snprintf(name, sizeof(name), "submitStudentRecord_%uproducers", num_threads);
+        reportResult(name, num_students, num_students, num_students, timeProducers(order, num_students, num_threads, 1));
+        clearList();
+        snprintf(name, sizeof(name), "addStudentInfoToList_%uproducers", num_threads);
+        reportResult(name, num_students, num_students, num_students, timeProducers(order, num_students, num_threads, 0));
+        clearList();
+    }
+    setConcurrentAccess(0);
+
+    /* Release the list and the buffers */
+    clearList();
+    free(batch);
+    free(order);
+    free(records);
+    free(nodes);
+}
+
+/**
+ * @brief Times an operation on generated students.
+ *
+ * This function generates the students of each batch before starting the clock, so only the time spent
+ * by the operation itself is measured.
+ *
+ * @param operation The function which runs the operation on one student.
+ * @param order The numbers of the students of the list, in random order.
+ * @param num_students The number of students of the list.
+ * @param num_ops The number of operations to run.
+ * @param is_distinct 1 to take the students in the order of the list of numbers, 0 to pick them at random.
+ * @return The time spent by the operations, in nanoseconds.
+ */
+static uint64_t timeOperation(BenchOperation_t operation, const uint32_t *order, uint32_t num_students,
+                              uint32_t num_ops, int32_t is_distinct)
+{
+    BenchRecord_t *records = (BenchRecord_t *)malloc(BENCH_BATCH_SIZE * sizeof(BenchRecord_t)); /* The generated students of a batch */
+    uint32_t batch_size = 0;            /* The number of students of the current batch */
+    uint32_t i = 0;                     /* Initialize temporary variable */
+    uint32_t j = 0;                     /* Initialize temporary variable */
+    uint64_t start = 0;                 /* The time when the timed operations start */
+    uint64_t elapsed_ns = 0;            /* The time spent by the operations */
+
+    for (i = 0; i < num_ops; i += batch_size)
+    {
+        batch_size = ((num_ops - i) < BENCH_BATCH_SIZE) ? (num_ops - i) : BENCH_BATCH_SIZE;
+        for (j = 0; j < batch_size; j++)
+        {
+            makeRecord(is_distinct ? order[i + j] : (nextRandom() % num_students), &records[j]);
+        }
+
+        start = getTimeNs();
+        for (j = 0; j < batch_size; j++)
+        {
+            operation(&records[j]);
+        }
+        elapsed_ns += getTimeNs() - start;
+    }
+    free(records);
+    /* Return the time spent by the operations */
+    return elapsed_ns;
+}
+
+/**
+ * @brief Times lookups by ID run by several threads at the same time.
+ *
+ * This function shares the lookups between threads which look up the generated students from different
+ * positions, and waits for every thread. When num_sorts is not NULL, one more thread sorts the list by score
+ * and by name in turn while the lookups run, so the readers wait for it each time it holds the lock.
+ * The lock of the list must be enabled with setConcurrentAccess.
+ *
+ * @param records The generated students which are looked up.
+ * @param num_records The number of generated students.
+ * @param num_readers The number of threads of the lookups, between 1 and BENCH_MAX_READERS.
+ * @param num_lookups The number of lookups shared by the threads.
+ * @param num_sorts Pointer to a variable which receives the number of sorts of a thread changing the list
+ *                  during the lookups, NULL to run the lookups alone.
+ * @return The time spent until every lookup is done, in nanoseconds.
+ */
+static uint64_t timeConcurrentLookups(BenchRecord_t *records, uint32_t num_records, uint32_t num_readers,
+                                      uint32_t num_lookups, uint32_t *num_sorts)
+{
+#ifdef _WIN32
+    HANDLE threads[BENCH_MAX_READERS + 1];      /* The threads of the readers, then the one of the writer */
+#else
+    pthread_t threads[BENCH_MAX_READERS + 1];   /* The threads of the readers, then the one of the writer */
+#endif
+    int32_t is_started[BENCH_MAX_READERS + 1];  /* 1 if the thread is started */
+    BenchReader_t readers[BENCH_MAX_READERS];   /* The work of each reader */
+    uint32_t num_threads = num_readers;         /* The number of threads to be started */
+    uint32_t i = 0;                             /* Initialize temporary variable */
+    uint64_t start = 0;                         /* The time when the threads are started */
+    uint64_t elapsed_ns = 0;                    /* The time spent until every lookup is done */
+
+    for (i = 0; i < num_readers; i++)
+    {
+        readers[i].records = records;
+        readers[i].num_records = num_records;
+        readers[i].first = (i * num_records) / num_readers;
+        readers[i].num_lookups = (num_lookups / num_readers) + ((i < (num_lookups % num_readers)) ? 1 : 0);
+    }
+    __atomic_store_n(&num_readers_left, (int32_t)num_readers, __ATOMIC_RELEASE);
+    if (num_sorts != NULL)
+    {
+        *num_sorts = 0;
+        num_threads++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Start the readers, then the writer */
+    start = getTimeNs();
+    for (i = 0; i < num_threads; i++)
+    {
+#ifdef _WIN32
+        threads[i] = (i < num_readers) ? CreateThread(NULL, 0, readerThreadMain, &readers[i], 0, NULL)
+                                       : CreateThread(NULL, 0, writerThreadMain, num_sorts, 0, NULL);
+        is_started[i] = (threads[i] != NULL) ? 1 : 0;
+#else
+        is_started[i] = (pthread_create(&threads[i], NULL, (i < num_readers) ? readerThreadMain : writerThreadMain,
+                                        (i < num_readers) ? (void *)&readers[i] : (void *)num_sorts) == 0) ? 1 : 0;
+#endif
+    }
+
+    /* Wait for every thread, run the lookups of the readers which are not started */
+    for (i = 0; i < num_threads; i++)
+    {
+        if (is_started[i])
+        {
+#ifdef _WIN32
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        }
+        else if (i < num_readers)
+        {
+            readerThreadMain(&readers[i]);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        /* The lookups are done once the last reader has been waited for */
+        if ((i + 1) == num_readers)
+        {
+            elapsed_ns = getTimeNs() - start;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    /* Return the time spent until every lookup is done */
+    return elapsed_ns;
+}
+
+/**
+ * @brief Times the building of a list by several threads adding students at the same time.
+ *
+ * This function shares the numbers of the students between threads which generate the students, like
+ * threads parsing files would, and add them to the list. Through the queue, the students are added once
+ * every thread is done by flushSubmittedStudents. The lock of the list must be enabled with setConcurrentAccess.
+ *
+ * @param order The numbers of the students of the list, in random order.
+ * @param num_students The number of students of the list.
+ * @param num_producers The number of threads, between 1 and BENCH_MAX_PRODUCERS.
+ * @param is_queued 1 to submit the students with submitStudentRecord, 0 to add them with addStudentInfoToList.
+ * @return The time spent until every student is on the list, in nanoseconds.
+ */
+static uint64_t timeProducers(const uint32_t *order, uint32_t num_students, uint32_t num_producers,
+                              int32_t is_queued)
+{
+#ifdef _WIN32
+    HANDLE threads[BENCH_MAX_PRODUCERS];        /* The threads of the producers */
+#else
+    pthread_t threads[BENCH_MAX_PRODUCERS];     /* The threads of the producers */
+#endif
+    int32_t is_started[BENCH_MAX_PRODUCERS];    /* 1 if the thread is started */
+    BenchProducer_t producers[BENCH_MAX_PRODUCERS]; /* The work of each producer */
+    uint32_t first = 0;                         /* The position of the first student of each producer */
+    uint32_t i = 0;                             /* Initialize temporary variable */
+    uint64_t start = 0;                         /* The time when the threads are started */
+
+    for (i = 0; i < num_producers; i++)
+    {
+        producers[i].numbers = &order[first];
+        producers[i].num_students = (num_students / num_producers) + ((i < (num_students % num_producers)) ? 1 : 0);
+        producers[i].is_queued = is_queued;
+        first += producers[i].num_students;
+    }
+    resetIngestResult();
+
+    start = getTimeNs();
+    for (i = 0; i < num_producers; i++)
+    {
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, producerThreadMain, &producers[i], 0, NULL);
+        is_started[i] = (threads[i] != NULL) ? 1 : 0;
+#else
+        is_started[i] = (pthread_create(&threads[i], NULL, producerThreadMain, &producers[i]) == 0) ? 1 : 0;
+#endif
+    }
+
+    /* Wait for every thread, run the producers which are not started */
+    for (i = 0; i < num_producers; i++)
+    {
+        if (is_started[i])
+        {
+#ifdef _WIN32
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        }
+        else
+        {
+            runProducer(&producers[i]);
+        }
+    }
+    flushSubmittedStudents(NULL);
+    /* Return the time spent until every student is on the list */
+    return getTimeNs() - start;
+}
+
+/**
+ * @brief Generates the information of a student from its number.
+ *
+ * The ID and the account are made of the number, the name is one of 4096 combinations of a family name,
+ * a middle name and a given name, and the average score has two decimals between 0 and 10.
+ *
+ * @param number The number of the student.
+ * @param record Pointer to a structure which receives the information of the student.
+ */
+static void makeRecord(uint32_t number, BenchRecord_t *record)
+{
+    uint32_t hash = number * 2654435761u;   /* The number mixed to choose the name and the score */
+
+    snprintf((char *)record->ID, STUDENT_KEY_SIZE, "SV%08u", number);
+    snprintf((char *)record->account, STUDENT_KEY_SIZE, "acc%08u", number);
+    snprintf((char *)record->name, BENCH_NAME_SIZE, "%s %s %s",
+             family_names[(hash >> 8) % BENCH_NAME_PARTS],
+             middle_names[(hash >> 12) % BENCH_NAME_PARTS],
+             given_names[(hash >> 16) % BENCH_NAME_PARTS]);
+    record->average_score = (float)((hash >> 20) % 1001u) / (float)100;
+}
+
+/**
+ * @brief Reports the result of a benchmark.
+ *
+ * This function writes one line to the report, with the number of nanoseconds per operation,
+ * the number of operations per second, the number of students processed per second and
+ * the peak resident memory of the process.
+ *
+ * @param benchmark The name of the benchmark.
+ * @param num_students The number of students of the list.
+ * @param num_ops The number of operations which have been timed.
+ * @param num_items The number of students processed by the operations.
+ * @param elapsed_ns The time spent by the operations, in nanoseconds.
+ */
+static void reportResult(const char *benchmark, uint32_t num_students, uint32_t num_ops,
+                         uint64_t num_items, uint64_t elapsed_ns)
+{
+    double seconds = (elapsed_ns > 0) ? ((double)elapsed_ns / 1e9) : 1e-9;  /* The time spent, at least one nanosecond */
+
+    if (format == BENCH_FORMAT_CSV)
+    {
+        fprintf(report, "%s,%u,%u,%.1f,%.3f,%.0f,%llu\n", benchmark, num_students, num_ops,
+                (double)elapsed_ns / num_ops, num_ops / seconds, (double)num_items / seconds,
+                (unsigned long long)getPeakRssKb());
+    }
+    else
+    {
+        fprintf(report, "{\"benchmark\":\"%s\",\"students\":%u,\"ops\":%u,\"ns_per_op\":%.1f,"
+                "\"ops_per_second\":%.3f,\"items_per_second\":%.0f,\"peak_rss_kb\":%llu}\n",
+                benchmark, num_students, num_ops, (double)elapsed_ns / num_ops, num_ops / seconds,
+                (double)num_items / seconds, (unsigned long long)getPeakRssKb());
+    }
+    fflush(report);
+}
+
+/**
+ * @brief Gets a random number.
+ *
+ * This function uses a xorshift64* generator, so the runs are the same on every platform.
+ *
+ * @return A pseudo-random number of 32 bits.
+ */
+static uint32_t nextRandom(void)
+{
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+    /* Return the high bits of the scrambled state */
+    return (uint32_t)((random_state * 0x2545F4914F6CDD1Du) >> 32);
+}
+
+/**
+ * @brief Gets the current time.
+ *
+ * @return The time of a monotonic clock, in nanoseconds.
+ */
+static uint64_t getTimeNs(void)
+{
+    uint64_t time_ns = 0;           /* The current time */
+#ifdef _WIN32
+    LARGE_INTEGER counter;          /* The value of the performance counter */
+    LARGE_INTEGER frequency;        /* The number of ticks of the performance counter per second */
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    time_ns = (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec now;            /* The value of the monotonic clock */
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    time_ns = (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+#endif
+    /* Return the current time */
+    return time_ns;
+}
+
+/**
+ * @brief Gets the peak resident memory of the process.
+ *
+ * @return The largest resident memory of the process so far, in kilobytes.
+ */
+static uint64_t getPeakRssKb(void)
+{
+    uint64_t peak_kb = 0;               /* The peak resident memory */
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;   /* The memory counters of the process */
+
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        peak_kb = (uint64_t)counters.PeakWorkingSetSize / 1024u;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#else
+    struct rusage usage;                /* The resource usage of the process */
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#ifdef __APPLE__
+        peak_kb = (uint64_t)usage.ru_maxrss / 1024u;
+#else
+        peak_kb = (uint64_t)usage.ru_maxrss;
+#endif
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+    /* Return the peak resident memory */
+    return peak_kb;
+}
+
+/**
+ * @brief Looks up a student with is_ID_Exist.
+ *
+ * @param record The generated student.
+ */
+static void runIdExist(BenchRecord_t *record)
+{
+    is_ID_Exist(record->ID);
+}
+
+/**
+ * @brief Compares two students by their average score in descending order, like sortByScore orders them.
+ *
+ * @param first The first student.
+ * @param second The second student.
+ * @return A negative value if first has a higher average score, a positive value if it has a lower one, 0 otherwise.
+ */
+static int32_t compareScores(const Student_t *first, const Student_t *second)
+{
+    return (int32_t)(first->average_score < second->average_score) -
+           (int32_t)(first->average_score > second->average_score);
+}
+
+/**
+ * @brief Compares two students by their name in ascending order, like sortByName orders them.
+ *
+ * @param first The first student.
+ * @param second The second student.
+ * @return The result of strcmp on the names of the two students.
+ */
+static int32_t compareNames(const Student_t *first, const Student_t *second)
+{
+    return (int32_t)strcmp((const char *)getStudentName(first), (const char *)getStudentName(second));
+}
+
+/**
+ * @brief Computes the statistics of the average scores by walking the list, like before computeClassStatistics.
+ *
+ * This function reads the average score of each student from its node and finds its band with a branch.
+ *
+ * @param statistics Pointer to a structure which receives the statistics.
+ */
+static void walkClassStatistics(ClassStatistics_t *statistics)
+{
+    Student_t *temp = student_list.head;    /* Temporary pointer to traverse the list */
+    double sum = 0.0;                   /* The sum of the average scores */
+    double sum_squares = 0.0;           /* The sum of the squares of the average scores */
+    double variance = 0.0;              /* The variance of the average scores */
+    int32_t band = 0;                   /* The band of each average score */
+
+    memset(statistics, 0, sizeof(ClassStatistics_t));
+    while (temp != NULL)
+    {
+        if ((statistics->num_students == 0) || (temp->average_score < statistics->min_score))
+        {
+            statistics->min_score = temp->average_score;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if ((statistics->num_students == 0) || (temp->average_score > statistics->max_score))
+        {
+            statistics->max_score = temp->average_score;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        sum += temp->average_score;
+        sum_squares += (double)temp->average_score * temp->average_score;
+        band = (int32_t)temp->average_score;
+        if (band < 0)
+        {
+            band = 0;
+        }
+        else if (band >= CLASS_STATS_BANDS)
+        {
+            band = CLASS_STATS_BANDS - 1;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        statistics->bands[band]++;
+        statistics->num_students++;
+        temp = temp->next;
+    }
+    if (statistics->num_students > 0)
+    {
+        statistics->mean = sum / statistics->num_students;
+        variance = (sum_squares / statistics->num_students) - (statistics->mean * statistics->mean);
+        statistics->std_dev = (variance > 0.0) ? sqrt(variance) : 0.0;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Checks the ID and the account of a student with checkStudentConflicts.
+ *
+ * @param record The generated student.
+ */
+static void runCheckConflicts(BenchRecord_t *record)
+{
+    checkStudentConflicts(record->ID, record->account);
+}
+
+/**
+ * @brief Searches a student with searchInfoByID.
+ *
+ * @param record The generated student.
+ */
+static void runSearchByID(BenchRecord_t *record)
+{
+    searchInfoByID(record->ID);
+}
+
+/**
+ * @brief Searches the students having the name of a student with searchInfoByName.
+ *
+ * @param record The generated student.
+ */
+static void runSearchByName(BenchRecord_t *record)
+{
+    searchInfoByName(record->name);
+}
+
+/**
+ * @brief Searches a student with searchInfoByAcc.
+ *
+ * @param record The generated student.
+ */
+static void runSearchByAcc(BenchRecord_t *record)
+{
+    searchInfoByAcc(record->account);
+}
+
+/**
+ * @brief Finds the students having a name with findStudentsByName.
+ *
+ * @param record The generated student.
+ */
+static void runFindByName(BenchRecord_t *record)
+{
+    StudentResultSet_t result;          /* The students found */
+
+    findStudentsByName(record->name, &result);
+    freeStudentResultSet(&result);
+}
+
+/**
+ * @brief Finds the students having an account with findStudentsByAccount.
+ *
+ * @param record The generated student.
+ */
+static void runFindByAccount(BenchRecord_t *record)
+{
+    StudentResultSet_t result;          /* The students found */
+
+    findStudentsByAccount(record->account, &result);
+    freeStudentResultSet(&result);
+}
+
+/**
+ * @brief Searches the students whose name starts with the name of a student with searchInfoByNamePattern.
+ *
+ * @param record The generated student.
+ */
+static void runSearchByNamePrefix(BenchRecord_t *record)
+{
+    searchInfoByNamePattern(record->name, NAME_MATCH_PREFIX);
+}
+
+/**
+ * @brief Searches the students whose name contains the middle and given names of a student with searchInfoByNamePattern.
+ *
+ * @param record The generated student.
+ */
+static void runSearchByNameSubstring(BenchRecord_t *record)
+{
+    searchInfoByNamePattern((int8_t *)strchr((char *)record->name, ' ') + 1, NAME_MATCH_SUBSTRING);
+}
+
+/**
+ * @brief Searches the students whose average score is close to the one of a student with searchInfoByScoreRange.
+ *
+ * @param record The generated student.
+ */
+static void runSearchByScoreRange(BenchRecord_t *record)
+{
+    searchInfoByScoreRange(record->average_score, record->average_score + BENCH_SCORE_RANGE);
+}
+
+/**
+ * @brief Counts the students of a wide range of average scores from the one of a student with
+ *        countStudentsByScoreRange.
+ *
+ * @param record The generated student.
+ */
+static void runCountByScoreRange(BenchRecord_t *record)
+{
+    countStudentsByScoreRange(record->average_score, record->average_score + BENCH_COUNT_RANGE);
+}
+
+/**
+ * @brief Displays the students having the highest average scores with showTopStudentsByScore.
+ *
+ * @param record The generated student, not used.
+ */
+static void runShowTopStudents(BenchRecord_t *record)
+{
+    (void)record;
+    showTopStudentsByScore(BENCH_TOP_STUDENTS);
+}
+
+/**
+ * @brief Deletes a student with deleteStudentInfo.
+ *
+ * @param record The generated student.
+ */
+static void runDelete(BenchRecord_t *record)
+{
+    deleteStudentInfo(record->ID);
+}
+
+/**
+ * @brief Runs the lookups of a thread of the concurrent lookups.
+ *
+ * This function looks up the generated students from the first position of the thread, going back to
+ * the beginning after the last one, then tells the writer that one less reader is running.
+ *
+ * @param reader The work of the thread.
+ */
+static void runReader(const BenchReader_t *reader)
+{
+    uint32_t position = reader->first;  /* The position of the looked up student */
+    uint32_t i = 0;                     /* Initialize temporary variable */
+
+    for (i = 0; i < reader->num_lookups; i++)
+    {
+        is_ID_Exist(reader->records[position].ID);
+        position = ((position + 1) == reader->num_records) ? 0 : (position + 1);
+    }
+    __atomic_sub_fetch(&num_readers_left, 1, __ATOMIC_ACQ_REL);
+}
+
+/**
+ * @brief Sorts the list by score and by name in turn until every thread of the concurrent lookups is done.
+ *
+ * Both sorts relink the students from their sorted views, so each one holds the lock of the list
+ * for one walk of the list.
+ *
+ * @param num_sorts Pointer to a variable which receives the number of sorts.
+ */
+static void runWriter(uint32_t *num_sorts)
+{
+    while (__atomic_load_n(&num_readers_left, __ATOMIC_ACQUIRE) > 0)
+    {
+        if ((*num_sorts % 2) == 0)
+        {
+            sortByScore();
+        }
+        else
+        {
+            sortByName();
+        }
+        (*num_sorts)++;
+    }
+}
+
+/**
+ * @brief Generates the students of a thread adding students at the same time as other threads, and adds them.
+ *
+ * @param producer The work of the thread.
+ */
+static void runProducer(const BenchProducer_t *producer)
+{
+    BenchRecord_t record;               /* Each generated student */
+    StudentRecord_t submitted;          /* The generated student given to submitStudentRecord */
+    uint32_t i = 0;                     /* Initialize temporary variable */
+
+    for (i = 0; i < producer->num_students; i++)
+    {
+        makeRecord(producer->numbers[i], &record);
+        if (producer->is_queued)
+        {
+            submitted.ID = record.ID;
+            submitted.name = record.name;
+            submitted.account = record.account;
+            submitted.average_score = record.average_score;
+            submitStudentRecord(&submitted);
+        }
+        else
+        {
+            addStudentInfoToList(createStudentInfo(record.ID, record.name, record.account, record.average_score));
+        }
+    }
+}
+
+#ifdef _WIN32
+/**
+ * @brief Runs the lookups of a thread of the concurrent lookups.
+ *
+ * @param arg The work of the thread.
+ * @return Always 0.
+ */
+static DWORD WINAPI readerThreadMain(LPVOID arg)
+{
+    runReader((const BenchReader_t *)arg);
+    return 0;
+}
+
+/**
+ * @brief Sorts the list by score and by name in turn until every thread of the concurrent lookups is done.
+ *
+ * @param arg Pointer to a variable which receives the number of sorts.
+ * @return Always 0.
+ */
+static DWORD WINAPI writerThreadMain(LPVOID arg)
+{
+    runWriter((uint32_t *)arg);
+    return 0;
+}
+
+/**
+ * @brief Runs a thread adding students at the same time as other threads.
+ *
+ * @param arg The work of the thread.
+ * @return Always 0.
+ */
+static DWORD WINAPI producerThreadMain(LPVOID arg)
+{
+    runProducer((const BenchProducer_t *)arg);
+    return 0;
+}
+#else
+/**
+ * @brief Runs the lookups of a thread of the concurrent lookups.
+ *
+ * @param arg The work of the thread.
+ * @return Always NULL.
+ */
+static void *readerThreadMain(void *arg)
+{
+    runReader((const BenchReader_t *)arg);
+    return NULL;
+}
+
+/**
+ * @brief Sorts the list by score and by name in turn until every thread of the concurrent lookups is done.
+ *
+ * @param arg Pointer to a variable which receives the number of sorts.
+ * @return Always NULL.
+ */
+static void *writerThreadMain(void *arg)
+{
+    runWriter((uint32_t *)arg);
+    return NULL;
+}
+
+/**
+ * @brief Runs a thread adding students at the same time as other threads.
+ *
+ * @param arg The work of the thread.
+ * @return Always NULL.
+ */
+static void *producerThreadMain(void *arg)
+{
+    runProducer((const BenchProducer_t *)arg);
+    return NULL;
+}
+#endif /* EOF */
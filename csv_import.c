@@ -0,0 +1,329 @@
+/**
+ * @file csv_import.c
+ * @brief This file contains the function definitions for importing students from a CSV file.
+ *
+ * The file includes the function definitions of a streaming importer which reads a CSV file in large chunks.
+ * Complete rows are split into fields in place inside the chunk, the incomplete row at the end of a chunk
+ * is moved to the start of the buffer before the next chunk is read.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "csv_import.h"     /* Include header file of this function file */
+#include "list_lock.h"      /* Include header file for the reader-writer lock of the list */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define CSV_CHUNK_SIZE      (1024 * 1024)       /* The number of bytes read from the file at once */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Imports students from a CSV file.
+ *
+ * This function reads a CSV file in chunks of 1 MiB and splits each complete row into its fields in place,
+ * without copying them. A first row whose average score is not a number is taken as a header and skipped.
+ * A row is added to the list with createStudentInfo and addStudentInfoToList if:
+ * - it has four fields, the ID and the account are not empty and shorter than STUDENT_KEY_SIZE characters,
+ * - the average score is a floating-point number between 0 and 10, checked like in the menu of the program,
+ * - its ID and its account do not exist in the list yet.
+ * Every other row is counted as rejected.
+ * The lock of the list is held exclusive during the whole import, so no snapshot can be opened meanwhile.
+ *
+ * @param path The path of the CSV file.
+ * @param result Pointer to a structure which receives the result of the import.
+ * @return 1 if the file is read, 0 if it cannot be opened or the list is a read-only snapshot.
+ */
+int32_t importStudentsFromCsv(const char *path, CsvImportResult_t *result)
+{
+    int32_t is_read = 0;                /* Initialize is_read to 0 */
+    FILE *file = NULL;                  /* The CSV file */
+    int8_t *buffer = NULL;              /* The buffer holding the chunk and the incomplete row before it */
+    size_t length = 0;                  /* The number of bytes in the buffer */
+    size_t num_read = 0;                /* The number of bytes read by the last call */
+    int8_t *row = NULL;                 /* The first character of the current row */
+    int8_t *row_end = NULL;             /* The end of line character of the current row */
+    int8_t *buffer_end = NULL;          /* The character after the last byte in the buffer */
+    int32_t is_first_row = 1;           /* 1 until the first row is imported */
+    int32_t is_skipping = 0;            /* 1 while the rest of a row longer than a chunk is skipped */
+    CsvRowStatus_t status = CSV_ROW_SKIPPED;    /* The status of each imported row */
+    clock_t start = clock();            /* The time when the import starts */
+
+    result->num_imported = 0;
+    result->num_rejected = 0;
+    result->seconds = 0;
+    result->rows_per_second = 0;
+
+    lockListExclusive();
+
+    /* A read-only snapshot cannot be modified */
+    if (!is_List_ReadOnly())
+    {
+        file = fopen(path, "rb");
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* If the file is opened */
+    if (file != NULL)
+    {
+        is_read = 1;
+        /* Keep one more byte to terminate the last row of the file */
+        buffer = (int8_t *)malloc(CSV_CHUNK_SIZE + 1);
+
+        do
+        {
+            /* Read the next chunk after the incomplete row */
+            num_read = fread(buffer + length, 1, CSV_CHUNK_SIZE - length, file);
+            length += num_read;
+            buffer_end = buffer + length;
+            row = buffer;
+
+            /* If the end of the file is reached, terminate the last row */
+            if ((num_read == 0) && (length > 0))
+            {
+                *buffer_end = '\n';
+                buffer_end++;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+
+            /* Import every complete row of the buffer */
+            row_end = (int8_t *)memchr(row, '\n', (size_t)(buffer_end - row));
+            while (row_end != NULL)
+            {
+                /* The rest of a too long row is not imported */
+                if (is_skipping)
+                {
+                    is_skipping = 0;
+                }
+                else
+                {
+                    status = importCsvRow(row, row_end, is_first_row);
+                    is_first_row = 0;
+                    /* Count the row */
+                    if (status == CSV_ROW_IMPORTED)
+                    {
+                        result->num_imported++;
+                    }
+                    else if (status == CSV_ROW_REJECTED)
+                    {
+                        result->num_rejected++;
+                    }
+                    else
+                    {
+                        /* Do nothing */
+                    }
+                }
+                row = row_end + 1;
+                row_end = (int8_t *)memchr(row, '\n', (size_t)(buffer_end - row));
+            }
+
+            /* Move the incomplete row to the start of the buffer */
+            length = (size_t)(buffer_end - row);
+            if (length == CSV_CHUNK_SIZE)
+            {
+                /* A row longer than a chunk is rejected */
+                if (!is_skipping)
+                {
+                    result->num_rejected++;
+                    is_skipping = 1;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                length = 0;
+            }
+            else
+            {
+                memmove(buffer, row, length);
+            }
+        }
+        while ((num_read > 0) || (length > 0));
+
+        /* Close the file and free the buffer */
+        fclose(file);
+        free(buffer);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListExclusive();
+
+    /* Compute the throughput of the import */
+    result->seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (result->seconds > 0)
+    {
+        result->rows_per_second = (result->num_imported + result->num_rejected) / result->seconds;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the value of is_read */
+    return is_read;
+}
+
+/**
+ * @brief Imports one row of a CSV file.
+ *
+ * This function splits a row into its fields in place and adds the student to the list if the row is valid,
+ * following the rules of importStudentsFromCsv.
+ * The lock of the list is held exclusive from the duplicate check until the student is added, so another
+ * thread cannot add the same ID or account in between.
+ * The name is the text between the first comma and the last but one comma, so it may contain commas.
+ * The character at row_end is overwritten by a null terminator.
+ *
+ * @param row The first character of the row.
+ * @param row_end The character after the last character of the row.
+ * @param is_first_row 1 if the row may be a header, 0 otherwise.
+ * @return CSV_ROW_IMPORTED if the student is added, CSV_ROW_REJECTED if the row is not valid or
+ *         CSV_ROW_SKIPPED if the row is empty or a header.
+ */
+CsvRowStatus_t importCsvRow(int8_t *row, int8_t *row_end, int32_t is_first_row)
+{
+    int32_t is_valid_input = 1;         /* Initialize is_valid_input to 1 */
+    CsvRowStatus_t status = CSV_ROW_REJECTED;   /* Initialize status to CSV_ROW_REJECTED */
+    int8_t *ID = row;                   /* The ID field */
+    int8_t *name = NULL;                /* The name field */
+    int8_t *account = NULL;             /* The account field */
+    int8_t *score = NULL;               /* The average score field */
+    int8_t *comma = NULL;               /* Temporary pointer to find the commas */
+    float average_score = 0;            /* The average score of the student */
+
+    /* Remove the carriage return of a Windows end of line */
+    if ((row_end > row) && (row_end[-1] == '\r'))
+    {
+        row_end--;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    *row_end = '\0';
+
+    /* An empty row is skipped without being counted */
+    if (row_end == row)
+    {
+        is_valid_input = 0;
+        status = CSV_ROW_SKIPPED;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Find the comma after the ID */
+    comma = (int8_t *)memchr(row, ',', (size_t)(row_end - row));
+    if (is_valid_input && (comma != NULL))
+    {
+        *comma = '\0';
+        name = comma + 1;
+        /* Find the comma before the average score */
+        comma = row_end - 1;
+        while ((comma >= name) && (*comma != ','))
+        {
+            comma--;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if ((name != NULL) && (comma >= name))
+    {
+        *comma = '\0';
+        score = comma + 1;
+        /* Find the comma before the account */
+        comma--;
+        while ((comma >= name) && (*comma != ','))
+        {
+            comma--;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if ((score != NULL) && (comma >= name))
+    {
+        *comma = '\0';
+        account = comma + 1;
+    }
+    else
+    {
+        is_valid_input = 0;
+    }
+
+    /* Check the average score like the menu of the program does */
+    if (is_valid_input && ((*score == '\0') || !isFloatingNumber(score)))
+    {
+        is_valid_input = 0;
+        /* A first row without a numeric average score is a header */
+        if (is_first_row)
+        {
+            status = CSV_ROW_SKIPPED;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if (is_valid_input)
+    {
+        average_score = (float)atof(score);
+        if ((average_score < (float)0) || (average_score > (float)10))
+        {
+            is_valid_input = 0;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    lockListExclusive();
+
+    /* Check the ID and the account */
+    if (is_valid_input &&
+        ((*ID == '\0') || (strlen(ID) >= STUDENT_KEY_SIZE) ||
+         (*account == '\0') || (strlen(account) >= STUDENT_KEY_SIZE) ||
+         (checkStudentConflicts(ID, account) != STUDENT_CONFLICT_NONE)))
+    {
+        is_valid_input = 0;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Add the student to the list if the row is valid */
+    if (is_valid_input)
+    {
+        addStudentInfoToList(createStudentInfo(ID, name, account, average_score));
+        status = CSV_ROW_IMPORTED;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListExclusive();
+    /* Return the status of the row */
+    return status;
+} /* EOF */
@@ -0,0 +1,95 @@
+/**
+ * @file csv_import.h
+ * @brief This file contains the function prototypes and data structures for importing students from a CSV file.
+ *
+ * This file contains the function prototypes and data structures of a streaming importer which reads a CSV file
+ * in large chunks and appends every valid row to the list of students.
+ * Each row has the form: ID,name,account,average score
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdio.h>              /* Include standard input and output library for fopen(), fread(), ... */
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For malloc(), free(), atof() functions */
+#include <string.h>             /* For memchr(), memmove() functions */
+#include <time.h>               /* For clock() function */
+#include "manage_students.h"    /* Include header file for managing students' information by using linked list */
+#include "input_handler.h"      /* Include header file for the isFloatingNumber function */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef CSV_IMPORT_H
+#define CSV_IMPORT_H
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @enum CsvRowStatus
+ * @brief This enumeration lists the results of importing one row.
+ */
+typedef enum CsvRowStatus
+{
+    CSV_ROW_IMPORTED = 0,       /* The student of the row is added to the list */
+    CSV_ROW_REJECTED,           /* The row is not valid or its ID or account already exists */
+    CSV_ROW_SKIPPED             /* The row is empty or is a header */
+} CsvRowStatus_t;
+
+/**
+ * @struct CsvImportResult
+ * @brief This structure represents the result of an import.
+ */
+typedef struct CsvImportResult
+{
+    int32_t num_imported;       /* The number of rows which are added to the list */
+    int32_t num_rejected;       /* The number of rows which are not valid or whose ID or account already exists */
+    double seconds;             /* The time spent on the import, in seconds */
+    double rows_per_second;     /* The number of rows read per second */
+} CsvImportResult_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Imports students from a CSV file.
+ *
+ * This function reads a CSV file in chunks of 1 MiB and splits each complete row into its fields in place,
+ * without copying them. A first row whose average score is not a number is taken as a header and skipped.
+ * A row is added to the list with createStudentInfo and addStudentInfoToList if:
+ * - it has four fields, the ID and the account are not empty and shorter than STUDENT_KEY_SIZE characters,
+ * - the average score is a floating-point number between 0 and 10, checked like in the menu of the program,
+ * - its ID and its account do not exist in the list yet.
+ * Every other row is counted as rejected.
+ * The lock of the list is held exclusive during the whole import, so no snapshot can be opened meanwhile.
+ *
+ * @param path The path of the CSV file.
+ * @param result Pointer to a structure which receives the result of the import.
+ * @return 1 if the file is read, 0 if it cannot be opened or the list is a read-only snapshot.
+ */
+int32_t importStudentsFromCsv(const char *path, CsvImportResult_t *result);
+
+/**
+ * @brief Imports one row of a CSV file.
+ *
+ * This function splits a row into its fields in place and adds the student to the list if the row is valid,
+ * following the rules of importStudentsFromCsv.
+ * The lock of the list is held exclusive from the duplicate check until the student is added, so another
+ * thread cannot add the same ID or account in between.
+ * The name is the text between the first comma and the last but one comma, so it may contain commas.
+ * The character at row_end is overwritten by a null terminator.
+ *
+ * @param row The first character of the row.
+ * @param row_end The character after the last character of the row.
+ * @param is_first_row 1 if the row may be a header, 0 otherwise.
+ * @return CSV_ROW_IMPORTED if the student is added, CSV_ROW_REJECTED if the row is not valid or
+ *         CSV_ROW_SKIPPED if the row is empty or a header.
+ */
+CsvRowStatus_t importCsvRow(int8_t *row, int8_t *row_end, int32_t is_first_row);
+
+#endif /* CSV_IMPORT_H */
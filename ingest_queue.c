@@ -0,0 +1,328 @@
+/**
+ * @file ingest_queue.c
+ * @brief This file contains the function definitions for the concurrent ingestion of students.
+ *
+ * The file includes the function definitions of a queue with many producers and one consumer at a time.
+ * The queue is a singly linked list whose tail is swapped atomically by the producers, then linked from
+ * the previous tail, and whose head is only moved by the consumer. A node always stays in the queue
+ * until the next one is linked after it, the empty queue keeping a stub node, so the consumer never frees
+ * a node which a producer may still write. The role of consumer is taken with a compare-and-swap by
+ * the thread which adds the queued students to the list.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "ingest_queue.h"       /* Include header file of this function file */
+#ifdef _WIN32
+#include <windows.h>            /* For SwitchToThread() function */
+#else
+#include <sched.h>              /* For sched_yield() function */
+#endif
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Links a node at the tail of the queue.
+ *
+ * @param node The node to be linked.
+ */
+static void pushIngestNode(IngestNode_t *node);
+
+/**
+ * @brief Unlinks the node at the head of the queue.
+ *
+ * @return The unlinked node, NULL if the queue is empty or its last node is being linked by a producer.
+ */
+static IngestNode_t *popIngestNode(void);
+
+/**
+ * @brief Adds the queued students to the list if no other thread is doing it.
+ *
+ * @return 1 if the queue has been emptied by the calling thread, 0 if another thread is doing it.
+ */
+static int32_t tryDrainQueue(void);
+
+/**
+ * @brief Lets the other threads run before the calling thread continues.
+ */
+static void yieldThread(void);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static IngestNode_t queue_stub;                     /* The node left in the queue when it is empty */
+static IngestNode_t *queue_head = &queue_stub;      /* The first node of the queue, only moved by the consumer */
+static IngestNode_t *queue_tail = &queue_stub;      /* The last node of the queue, swapped by the producers */
+static int32_t num_pending = 0;                     /* The number of students queued and not added yet */
+static int32_t is_draining = 0;                     /* 1 while a thread adds the queued students to the list */
+static IngestResult_t ingest_result;                /* The result of the students submitted since the last reset */
+static IngestNode_t *batch_nodes[INGEST_BATCH_SIZE];        /* The nodes of the batch being added, used by the consumer */
+static StudentRecord_t batch_records[INGEST_BATCH_SIZE];    /* The students of the batch being added, used by the consumer */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Submits a student to be added to the list.
+ *
+ * This function checks the lengths of the ID and the account, copies the student into a node sized
+ * for its name and links it at the tail of the queue. Every INGEST_BATCH_SIZE submitted students,
+ * the calling thread tries to take the role of consumer and add the queued students to the list.
+ *
+ * @param record The student to be submitted.
+ * @return 1 if the student is queued, 0 if it is rejected or the memory of the node cannot be allocated.
+ */
+int32_t submitStudentRecord(const StudentRecord_t *record)
+{
+    IngestNode_t *node = NULL;          /* The node of the student */
+    size_t ID_length = strlen(record->ID);              /* The number of characters of the ID */
+    size_t account_length = strlen(record->account);    /* The number of characters of the account */
+    size_t name_length = strlen(record->name);          /* The number of characters of the name */
+    int32_t num_submitted = 0;          /* The number of queued students, including this one */
+    int32_t is_queued = 0;              /* 1 if the student is queued */
+
+    /* If the ID and the account fit in a node */
+    if ((ID_length > 0) && (ID_length < STUDENT_KEY_SIZE) &&
+        (account_length > 0) && (account_length < STUDENT_KEY_SIZE))
+    {
+        node = (IngestNode_t *)malloc(sizeof(IngestNode_t) + name_length + 1);
+        if (node != NULL)
+        {
+            memcpy(node->ID, record->ID, ID_length + 1);
+            memcpy(node->account, record->account, account_length + 1);
+            memcpy(node->name, record->name, name_length + 1);
+            node->average_score = record->average_score;
+            __atomic_add_fetch(&num_pending, 1, __ATOMIC_RELAXED);
+            pushIngestNode(node);
+            num_submitted = __atomic_add_fetch(&ingest_result.num_submitted, 1, __ATOMIC_RELAXED);
+            is_queued = 1;
+
+            /* Add a batch to the list every INGEST_BATCH_SIZE students */
+            if ((num_submitted % INGEST_BATCH_SIZE) == 0)
+            {
+                tryDrainQueue();
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        __atomic_add_fetch(&ingest_result.num_rejected, 1, __ATOMIC_RELAXED);
+    }
+    /* Return 1 if the student is queued */
+    return is_queued;
+}
+
+/**
+ * @brief Adds every queued student to the list.
+ *
+ * This function adds the queued students to the list, or waits for the thread which is doing it,
+ * until no student is pending. The result is read after the role of consumer is released.
+ *
+ * @param result Pointer to a structure which receives the result of the students submitted since the last reset,
+ *               may be NULL.
+ */
+void flushSubmittedStudents(IngestResult_t *result)
+{
+    tryDrainQueue();
+    /* A student stays pending while another thread adds it or while its producer links it */
+    while (__atomic_load_n(&num_pending, __ATOMIC_ACQUIRE) > 0)
+    {
+        yieldThread();
+        tryDrainQueue();
+    }
+
+    if (result != NULL)
+    {
+        result->num_submitted = __atomic_load_n(&ingest_result.num_submitted, __ATOMIC_ACQUIRE);
+        result->num_added = __atomic_load_n(&ingest_result.num_added, __ATOMIC_ACQUIRE);
+        result->num_rejected = __atomic_load_n(&ingest_result.num_rejected, __ATOMIC_ACQUIRE);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Resets the result of the submitted students.
+ */
+void resetIngestResult(void)
+{
+    __atomic_store_n(&ingest_result.num_submitted, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&ingest_result.num_added, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&ingest_result.num_rejected, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Links a node at the tail of the queue.
+ *
+ * This function swaps the tail of the queue with the node, then links the node after the previous tail.
+ * Until then the consumer sees the previous tail as the last node, so it waits for the link instead
+ * of freeing it.
+ *
+ * @param node The node to be linked.
+ */
+static void pushIngestNode(IngestNode_t *node)
+{
+    IngestNode_t *previous = NULL;      /* The tail of the queue before the node */
+
+    __atomic_store_n(&node->next, NULL, __ATOMIC_RELAXED);
+    previous = __atomic_exchange_n(&queue_tail, node, __ATOMIC_ACQ_REL);
+    __atomic_store_n(&previous->next, node, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Unlinks the node at the head of the queue.
+ *
+ * This function is only called by the consumer. The stub is skipped when it is at the head. A node is only
+ * unlinked once another node is linked after it, so when the head is the last node the stub is linked
+ * after it first. The unlinked node is no longer written by any thread and may be freed.
+ *
+ * @return The unlinked node, NULL if the queue is empty or its last node is being linked by a producer.
+ */
+static IngestNode_t *popIngestNode(void)
+{
+    IngestNode_t *head = queue_head;    /* The node at the head of the queue */
+    IngestNode_t *next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);    /* The node after the head */
+    IngestNode_t *node = NULL;          /* The unlinked node */
+
+    /* Skip the stub, the queue is empty if nothing is linked after it */
+    if (head == &queue_stub)
+    {
+        if (next != NULL)
+        {
+            queue_head = next;
+            head = next;
+            next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);
+        }
+        else
+        {
+            head = NULL;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    if (head == NULL)
+    {
+        /* Do nothing */
+    }
+    else if (next != NULL)
+    {
+        queue_head = next;
+        node = head;
+    }
+    else if (__atomic_load_n(&queue_tail, __ATOMIC_ACQUIRE) == head)
+    {
+        /* The head is the last node, link the stub after it so it can be unlinked */
+        pushIngestNode(&queue_stub);
+        next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);
+        if (next != NULL)
+        {
+            queue_head = next;
+            node = head;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing, a producer is linking a node after the head */
+    }
+    /* Return the unlinked node */
+    return node;
+}
+
+/**
+ * @brief Adds the queued students to the list if no other thread is doing it.
+ *
+ * This function takes the role of consumer with a compare-and-swap, then unlinks the queued students
+ * INGEST_BATCH_SIZE at a time, adds them to the list with addStudentsBatch and frees their nodes.
+ *
+ * @return 1 if the queue has been emptied by the calling thread, 0 if another thread is doing it.
+ */
+static int32_t tryDrainQueue(void)
+{
+    IngestNode_t *node = NULL;          /* Each unlinked node */
+    int32_t expected = 0;               /* The role of consumer is free */
+    int32_t num_nodes = 0;              /* The number of nodes of the current batch */
+    int32_t num_added = 0;              /* The number of students of the batch added to the list */
+    int32_t num_rejected = 0;           /* The number of students of the batch rejected by addStudentsBatch */
+    int32_t is_drained = 0;             /* 1 if the calling thread has the role of consumer */
+    int32_t i = 0;                      /* Position of each node of the batch */
+
+    if (__atomic_compare_exchange_n(&is_draining, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+    {
+        do
+        {
+            /* Unlink a batch of nodes */
+            num_nodes = 0;
+            node = popIngestNode();
+            while (node != NULL)
+            {
+                batch_nodes[num_nodes] = node;
+                batch_records[num_nodes].ID = node->ID;
+                batch_records[num_nodes].name = node->name;
+                batch_records[num_nodes].account = node->account;
+                batch_records[num_nodes].average_score = node->average_score;
+                num_nodes++;
+                node = (num_nodes < INGEST_BATCH_SIZE) ? popIngestNode() : NULL;
+            }
+
+            /* Add the batch to the list and free its nodes */
+            if (num_nodes > 0)
+            {
+                num_added = addStudentsBatch(batch_records, num_nodes, &num_rejected);
+                __atomic_add_fetch(&ingest_result.num_added, num_added, __ATOMIC_RELAXED);
+                __atomic_add_fetch(&ingest_result.num_rejected, num_rejected, __ATOMIC_RELAXED);
+                for (i = 0; i < num_nodes; i++)
+                {
+                    free(batch_nodes[i]);
+                }
+                __atomic_sub_fetch(&num_pending, num_nodes, __ATOMIC_RELEASE);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        } while (num_nodes == INGEST_BATCH_SIZE);
+
+        __atomic_store_n(&is_draining, 0, __ATOMIC_RELEASE);
+        is_drained = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return 1 if the queue has been emptied by the calling thread */
+    return is_drained;
+}
+
+/**
+ * @brief Lets the other threads run before the calling thread continues.
+ */
+static void yieldThread(void)
+{
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+} /* EOF */
@@ -0,0 +1,105 @@
+/**
+ * @file ingest_queue.h
+ * @brief This file contains the function prototypes and data structures for the concurrent ingestion of students.
+ *
+ * This file contains the function prototypes and data structures of a queue which lets several threads
+ * submit students to the list at the same time. A producer copies the student into a node and links it
+ * at the tail of the queue with one atomic exchange, so queuing never waits for the lock of the list or for
+ * another producer. The queued students are added to the list in batches with addStudentsBatch by one
+ * thread at a time, which is the only one checking that the IDs and the accounts are unique.
+ * The queue takes the lock of the list off the producers but does not make adding the students parallel,
+ * the indexes are still updated by one thread at a time.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For malloc(), free() functions */
+#include <string.h>             /* For strlen(), memcpy() functions */
+#include "manage_students.h"    /* Include header file for the StudentRecord_t structure and addStudentsBatch() */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef INGEST_QUEUE_H
+#define INGEST_QUEUE_H
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define INGEST_BATCH_SIZE   4096        /* The number of queued students added to the list by each call to addStudentsBatch */
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct IngestNode
+ * @brief This structure represents a student waiting in the queue.
+ *
+ * The node holds a copy of the student, so the producer may reuse its buffers as soon as it is queued.
+ */
+typedef struct IngestNode
+{
+    struct IngestNode *next;            /* Pointer to the next node of the queue */
+    int8_t ID[STUDENT_KEY_SIZE];        /* The ID of the student */
+    int8_t account[STUDENT_KEY_SIZE];   /* The account of the student */
+    float average_score;                /* The average score of the student */
+    int8_t name[];                      /* The name of the student */
+} IngestNode_t;
+
+/**
+ * @struct IngestResult
+ * @brief This structure represents the result of the students submitted since the last reset.
+ */
+typedef struct IngestResult
+{
+    int32_t num_submitted;      /* The number of students which have been queued */
+    int32_t num_added;          /* The number of queued students which are added to the list */
+    int32_t num_rejected;       /* The number of students which are not valid or whose ID or account already exists */
+} IngestResult_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Submits a student to be added to the list.
+ *
+ * This function may be called by several threads at the same time. It copies the student into a new node
+ * and links it at the tail of the queue. Every INGEST_BATCH_SIZE students, the submitting thread also adds
+ * the queued students to the list if no other thread is doing it, otherwise it returns at once.
+ * A student whose ID or account is empty or has STUDENT_KEY_SIZE characters or more is rejected without
+ * being queued. The other checks are made when the student is added to the list, like in addStudentsBatch,
+ * so of two students with the same ID or account only the first one linked to the queue is added.
+ * A queued student is therefore not yet accepted: it may still be rejected when it is added to the list,
+ * which is only reported by the num_rejected of flushSubmittedStudents, not to its producer.
+ * The other threads using the list at the same time require setConcurrentAccess.
+ *
+ * @param record The student to be submitted.
+ * @return 1 if the student is queued, 0 if it is rejected or the memory of the node cannot be allocated.
+ */
+int32_t submitStudentRecord(const StudentRecord_t *record);
+
+/**
+ * @brief Adds every queued student to the list.
+ *
+ * This function waits until the students submitted before it was called are on the list, or are rejected.
+ * It is called once the producers are done, or whenever the list has to see the submitted students.
+ * The result is the only place where the queued students rejected for a used ID or account are counted.
+ *
+ * @param result Pointer to a structure which receives the result of the students submitted since the last reset,
+ *               may be NULL.
+ */
+void flushSubmittedStudents(IngestResult_t *result);
+
+/**
+ * @brief Resets the result of the submitted students.
+ *
+ * This function must be called while no thread submits students.
+ */
+void resetIngestResult(void);
+
+#endif /* INGEST_QUEUE_H */
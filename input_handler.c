@@ -127,13 +127,19 @@ int32_t isFloatingNumber(int8_t input[])
  *
  * This function prompting the user to press any key to continue.
  * It then clears the input buffer, waits for a key press, and clears the console screen.
+ * On other systems than Windows, it waits for the Enter key instead.
  */
 void clearConsole(void)
 {
     printf("\n-------------------------------");
     printf("\nPress ANY key to Continue . . .");
     fflush(stdin);
+#ifdef _WIN32
     getch();
     system("cls");
+#else
+    getchar();
+    system("clear");
+#endif
 } /* EOF */
 
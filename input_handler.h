@@ -17,7 +17,9 @@
 #include <stdlib.h>         /* For system("cls") function. */
 #include <ctype.h>          /* For isdigit() function. */
 #include <stdint.h>         /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#ifdef _WIN32
 #include <conio.h>          /* For getch() function. */
+#endif
 
 /*******************************************************************************
  * Header guards
@@ -55,6 +57,7 @@ int32_t isFloatingNumber(int8_t input[]);
  *
  * This function prompting the user to press any key to continue.
  * It then clears the input buffer, waits for a key press, and clears the console screen.
+ * On other systems than Windows, it waits for the Enter key instead.
  */
 void clearConsole(void);
 
@@ -0,0 +1,173 @@
+/**
+ * @file list_lock.c
+ * @brief This file contains the function definitions for the reader-writer lock of the list of students.
+ *
+ * The file includes the function definitions of the lock of the list. It is a POSIX reader-writer lock,
+ * or a slim reader-writer lock when it is built on Windows. Each thread counts how many times it has taken
+ * the lock, and only the outermost lock and unlock reach the reader-writer lock. It also remembers whether
+ * the outermost lock is exclusive, because a thread reading the list cannot take the lock exclusive without
+ * writing under the other readers, so that upgrade stops the program.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "list_lock.h"          /* Include header file of this function file */
+#include <stdio.h>              /* For fprintf() function */
+#include <stdlib.h>             /* For abort() function */
+#ifdef _WIN32
+#include <windows.h>            /* For AcquireSRWLockShared(), AcquireSRWLockExclusive() functions */
+#else
+#include <pthread.h>            /* For pthread_rwlock_rdlock(), pthread_rwlock_wrlock() functions */
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+#ifdef _WIN32
+static SRWLOCK list_lock = SRWLOCK_INIT;                        /* The reader-writer lock of the list */
+#else
+static pthread_rwlock_t list_lock = PTHREAD_RWLOCK_INITIALIZER; /* The reader-writer lock of the list */
+#endif
+static int32_t is_enabled_lock = 0;                 /* 1 if the functions of the list take the lock, 0 otherwise */
+static __thread int32_t lock_depth = 0;             /* The number of times the current thread holds the lock */
+static __thread int32_t is_held_exclusive = 0;      /* 1 if the outermost lock of the current thread is exclusive */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Enables or disables the lock.
+ *
+ * @param is_enabled 1 to enable the lock, 0 to disable it.
+ */
+void enableListLock(int32_t is_enabled)
+{
+    is_enabled_lock = (is_enabled != 0) ? 1 : 0;
+}
+
+/**
+ * @brief Checks if the lock is enabled.
+ *
+ * @return 1 if the lock is enabled, 0 otherwise.
+ */
+int32_t is_ListLock_Enabled(void)
+{
+    return is_enabled_lock;
+}
+
+/**
+ * @brief Takes the lock to read the list.
+ */
+void lockListShared(void)
+{
+    /* Only the outermost lock of the thread waits for the writers */
+    if (is_enabled_lock && (lock_depth == 0))
+    {
+#ifdef _WIN32
+        AcquireSRWLockShared(&list_lock);
+#else
+        pthread_rwlock_rdlock(&list_lock);
+#endif
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    lock_depth++;
+}
+
+/**
+ * @brief Releases the lock taken by lockListShared.
+ */
+void unlockListShared(void)
+{
+    lock_depth--;
+    /* Only the outermost unlock of the thread releases the lock */
+    if (is_enabled_lock && (lock_depth == 0))
+    {
+#ifdef _WIN32
+        ReleaseSRWLockShared(&list_lock);
+#else
+        pthread_rwlock_unlock(&list_lock);
+#endif
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Takes the lock to change the list.
+ *
+ * The program is stopped if the thread holds the lock shared, the other readers would see the changes.
+ */
+void lockListExclusive(void)
+{
+    /* A reader must not change the list */
+    if ((lock_depth > 0) && (is_held_exclusive == 0))
+    {
+        fprintf(stderr, "lockListExclusive: the list is changed by a thread which holds the lock shared\n");
+        abort();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Only the outermost lock of the thread waits for the readers and the writers */
+    if (lock_depth == 0)
+    {
+        if (is_enabled_lock)
+        {
+#ifdef _WIN32
+            AcquireSRWLockExclusive(&list_lock);
+#else
+            pthread_rwlock_wrlock(&list_lock);
+#endif
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        is_held_exclusive = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    lock_depth++;
+}
+
+/**
+ * @brief Releases the lock taken by lockListExclusive.
+ */
+void unlockListExclusive(void)
+{
+    lock_depth--;
+    /* Only the outermost unlock of the thread releases the lock */
+    if (lock_depth == 0)
+    {
+        is_held_exclusive = 0;
+        if (is_enabled_lock)
+        {
+#ifdef _WIN32
+            ReleaseSRWLockExclusive(&list_lock);
+#else
+            pthread_rwlock_unlock(&list_lock);
+#endif
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+} /* EOF */
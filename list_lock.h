@@ -0,0 +1,72 @@
+/**
+ * @file list_lock.h
+ * @brief This file contains the function prototypes for the reader-writer lock of the list of students.
+ *
+ * This file contains the function prototypes of the lock which lets several threads use the list of students
+ * at the same time. The functions which only read the list take the lock shared, so they run in parallel
+ * with each other, and the functions which change the list take it exclusive, so they run alone.
+ * The lock is disabled by default and then costs one test per function.
+ * A thread which already holds the lock takes it again without waiting, so the functions of the list
+ * may call each other.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef LIST_LOCK_H
+#define LIST_LOCK_H
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Enables or disables the lock.
+ *
+ * This function must be called while no other thread uses the list.
+ *
+ * @param is_enabled 1 to enable the lock, 0 to disable it.
+ */
+void enableListLock(int32_t is_enabled);
+
+/**
+ * @brief Checks if the lock is enabled.
+ *
+ * @return 1 if the lock is enabled, 0 otherwise.
+ */
+int32_t is_ListLock_Enabled(void);
+
+/**
+ * @brief Takes the lock to read the list.
+ *
+ * This function waits while a thread changes the list. Nothing happens if the lock is disabled.
+ */
+void lockListShared(void);
+
+/**
+ * @brief Releases the lock taken by lockListShared.
+ */
+void unlockListShared(void);
+
+/**
+ * @brief Takes the lock to change the list.
+ *
+ * This function waits until no other thread reads or changes the list. Nothing happens if the lock is disabled.
+ * A thread holding the lock shared must not take it exclusive, the program is stopped if it does,
+ * whether the lock is enabled or not.
+ */
+void lockListExclusive(void);
+
+/**
+ * @brief Releases the lock taken by lockListExclusive.
+ */
+void unlockListExclusive(void);
+
+#endif /* LIST_LOCK_H */
@@ -0,0 +1,467 @@
+/**
+ * @file list_output.c
+ * @brief This file contains the function definitions for writing the list of students.
+ *
+ * The file includes the function definitions of a buffered writer of records of students.
+ * The numbers are formatted by hand and the buffer is written with write(), or _write() on Windows,
+ * so writing a large list costs one system call per megabyte instead of several stdio calls per student.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "list_output.h"        /* Include header file of this function file */
+#ifdef _WIN32
+#include <io.h>                 /* For _write(), _fileno() functions */
+#else
+#include <unistd.h>             /* For write() function */
+#endif
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Writes the bytes of the buffer to the file descriptor and empties the buffer.
+ *
+ * @param output The writer.
+ */
+static void flushListOutput(ListOutput_t *output);
+
+/**
+ * @brief Appends bytes to the buffer.
+ *
+ * @param output The writer.
+ * @param bytes The bytes to be appended.
+ * @param count The number of bytes.
+ */
+static void appendBytes(ListOutput_t *output, const int8_t *bytes, size_t count);
+
+/**
+ * @brief Appends a null-terminated text to the buffer.
+ *
+ * @param output The writer.
+ * @param text The text to be appended.
+ */
+static void appendText(ListOutput_t *output, const char *text);
+
+/**
+ * @brief Appends a character to the buffer several times.
+ *
+ * @param output The writer.
+ * @param character The character to be appended.
+ * @param count The number of times, nothing is appended if it is not positive.
+ */
+static void appendRepeated(ListOutput_t *output, int8_t character, int32_t count);
+
+/**
+ * @brief Appends a text to the buffer as a JSON string, between quotes and with its special characters escaped.
+ *
+ * @param output The writer.
+ * @param text The text to be appended.
+ * @param length The number of characters of the text.
+ */
+static void appendJsonString(ListOutput_t *output, const int8_t *text, size_t length);
+
+/**
+ * @brief Gets the number of characters of an ID or an account.
+ *
+ * @param key The ID or the account.
+ * @return The number of characters before the null terminator, at most STUDENT_KEY_SIZE - 1.
+ */
+static size_t getKeyLength(const int8_t *key);
+
+/**
+ * @brief Formats an average score with two decimals.
+ *
+ * @param text A buffer of at least 64 characters which receives the score, without null terminator.
+ * @param average_score The average score.
+ * @return The number of characters of the formatted score.
+ */
+static size_t formatScore(int8_t *text, float average_score);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static int8_t output_data[LIST_OUTPUT_BUFFER_SIZE];     /* The output buffer shared by every writer */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Starts writing records of students to a stream.
+ *
+ * This function flushes the stream, so the records follow what was printed to it before,
+ * then writes the header of the format: the column names and a line of dashes for a table,
+ * the column names for a CSV file, which importStudentsFromCsv skips.
+ *
+ * @param output The writer to be started.
+ * @param stream The stream whose file descriptor receives the records.
+ * @param format The format of the records.
+ */
+void beginListOutput(ListOutput_t *output, FILE *stream, OutputFormat_t format)
+{
+    fflush(stream);
+#ifdef _WIN32
+    output->fd = _fileno(stream);
+#else
+    output->fd = fileno(stream);
+#endif
+    output->format = format;
+    output->data = output_data;
+    output->length = 0;
+    output->num_bytes = 0;
+    output->is_failed = 0;
+
+    /* Write the header of the format */
+    switch (format)
+    {
+        case OUTPUT_FORMAT_TABLE:
+            appendText(output, "ID");
+            appendRepeated(output, ' ', STUDENT_KEY_SIZE - 1 - 2 + 1);
+            appendText(output, "Name");
+            appendRepeated(output, ' ', LIST_OUTPUT_NAME_WIDTH - 4 + 1);
+            appendText(output, "Account");
+            appendRepeated(output, ' ', STUDENT_KEY_SIZE - 1 - 7 + 1);
+            appendText(output, "Average score\n");
+            appendRepeated(output, '-', STUDENT_KEY_SIZE - 1);
+            appendRepeated(output, ' ', 1);
+            appendRepeated(output, '-', LIST_OUTPUT_NAME_WIDTH);
+            appendRepeated(output, ' ', 1);
+            appendRepeated(output, '-', STUDENT_KEY_SIZE - 1);
+            appendRepeated(output, ' ', 1);
+            appendRepeated(output, '-', LIST_OUTPUT_SCORE_WIDTH);
+            appendRepeated(output, '\n', 1);
+            break;
+        case OUTPUT_FORMAT_CSV:
+            appendText(output, "ID,name,account,score\n");
+            break;
+        default:
+            /* Do nothing */
+            break;
+    }
+}
+
+/**
+ * @brief Writes the record of a student.
+ *
+ * This function formats a record into the buffer in the format of the writer:
+ * - OUTPUT_FORMAT_BLOCK: the layout of showListStudents, one line per field between two lines of dashes,
+ * - OUTPUT_FORMAT_TABLE: one line per student in aligned columns, a longer name shifts the following columns,
+ * - OUTPUT_FORMAT_CSV: one row ID,name,account,score per student, which importStudentsFromCsv can read back,
+ * - OUTPUT_FORMAT_JSON: one JSON object per line.
+ *
+ * @param output The writer.
+ * @param ID The ID of the student, at most STUDENT_KEY_SIZE - 1 characters are written.
+ * @param name The name of the student.
+ * @param account The account of the student, at most STUDENT_KEY_SIZE - 1 characters are written.
+ * @param average_score The average score of the student.
+ */
+void writeRecordToOutput(ListOutput_t *output, const int8_t *ID, const int8_t *name, const int8_t *account,
+                         float average_score)
+{
+    int8_t score[64];                                   /* The formatted average score */
+    size_t score_length = formatScore(score, average_score);    /* The number of characters of the score */
+    size_t ID_length = getKeyLength(ID);                /* The number of characters of the ID */
+    size_t account_length = getKeyLength(account);      /* The number of characters of the account */
+    size_t name_length = strlen((const char *)name);    /* The number of characters of the name */
+
+    switch (output->format)
+    {
+        case OUTPUT_FORMAT_TABLE:
+            appendBytes(output, ID, ID_length);
+            appendRepeated(output, ' ', (int32_t)(STUDENT_KEY_SIZE - ID_length));
+            appendBytes(output, name, name_length);
+            appendRepeated(output, ' ', (name_length < LIST_OUTPUT_NAME_WIDTH) ?
+                                        (LIST_OUTPUT_NAME_WIDTH + 1 - (int32_t)name_length) : 1);
+            appendBytes(output, account, account_length);
+            appendRepeated(output, ' ', (int32_t)(STUDENT_KEY_SIZE - account_length));
+            appendRepeated(output, ' ', LIST_OUTPUT_SCORE_WIDTH - (int32_t)score_length);
+            appendBytes(output, score, score_length);
+            appendRepeated(output, '\n', 1);
+            break;
+        case OUTPUT_FORMAT_CSV:
+            appendBytes(output, ID, ID_length);
+            appendRepeated(output, ',', 1);
+            appendBytes(output, name, name_length);
+            appendRepeated(output, ',', 1);
+            appendBytes(output, account, account_length);
+            appendRepeated(output, ',', 1);
+            appendBytes(output, score, score_length);
+            appendRepeated(output, '\n', 1);
+            break;
+        case OUTPUT_FORMAT_JSON:
+            appendText(output, "{\"ID\":");
+            appendJsonString(output, ID, ID_length);
+            appendText(output, ",\"name\":");
+            appendJsonString(output, name, name_length);
+            appendText(output, ",\"account\":");
+            appendJsonString(output, account, account_length);
+            appendText(output, ",\"average_score\":");
+            appendBytes(output, score, score_length);
+            appendText(output, "}\n");
+            break;
+        default:
+            appendText(output, "\n-----\nID: ");
+            appendBytes(output, ID, ID_length);
+            appendText(output, "\nName: ");
+            appendBytes(output, name, name_length);
+            appendText(output, "\nAccount: ");
+            appendBytes(output, account, account_length);
+            appendText(output, "\nAverage score: ");
+            appendBytes(output, score, score_length);
+            appendText(output, "\n-----\n");
+            break;
+    }
+}
+
+/**
+ * @brief Finishes writing records of students.
+ *
+ * @param output The writer to be finished.
+ * @return 1 if every byte is written, 0 if a write failed.
+ */
+int32_t endListOutput(ListOutput_t *output)
+{
+    flushListOutput(output);
+    return (output->is_failed == 0) ? 1 : 0;
+}
+
+/**
+ * @brief Writes the bytes of the buffer to the file descriptor and empties the buffer.
+ *
+ * This function writes the buffer until every byte is written or a write fails.
+ * The bytes are dropped after a failed write, so the following records are not written.
+ *
+ * @param output The writer.
+ */
+static void flushListOutput(ListOutput_t *output)
+{
+    size_t offset = 0;          /* The number of bytes of the buffer written so far */
+    int64_t written = 0;        /* The number of bytes written by each call */
+
+    while ((offset < output->length) && (output->is_failed == 0))
+    {
+#ifdef _WIN32
+        written = _write(output->fd, output->data + offset, (unsigned int)(output->length - offset));
+#else
+        written = write(output->fd, output->data + offset, output->length - offset);
+#endif
+        if (written > 0)
+        {
+            offset += (size_t)written;
+            output->num_bytes += (uint64_t)written;
+        }
+        else
+        {
+            output->is_failed = 1;
+        }
+    }
+    output->length = 0;
+}
+
+/**
+ * @brief Appends bytes to the buffer.
+ *
+ * This function copies the bytes in pieces which fill the buffer, and writes the buffer each time it is full.
+ *
+ * @param output The writer.
+ * @param bytes The bytes to be appended.
+ * @param count The number of bytes.
+ */
+static void appendBytes(ListOutput_t *output, const int8_t *bytes, size_t count)
+{
+    size_t piece = 0;       /* The number of bytes copied at once */
+
+    while (count > 0)
+    {
+        if (output->length == LIST_OUTPUT_BUFFER_SIZE)
+        {
+            flushListOutput(output);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        piece = LIST_OUTPUT_BUFFER_SIZE - output->length;
+        piece = (count < piece) ? count : piece;
+        memcpy(output->data + output->length, bytes, piece);
+        output->length += piece;
+        bytes += piece;
+        count -= piece;
+    }
+}
+
+/**
+ * @brief Appends a null-terminated text to the buffer.
+ *
+ * @param output The writer.
+ * @param text The text to be appended.
+ */
+static void appendText(ListOutput_t *output, const char *text)
+{
+    appendBytes(output, (const int8_t *)text, strlen(text));
+}
+
+/**
+ * @brief Appends a character to the buffer several times.
+ *
+ * @param output The writer.
+ * @param character The character to be appended.
+ * @param count The number of times, nothing is appended if it is not positive.
+ */
+static void appendRepeated(ListOutput_t *output, int8_t character, int32_t count)
+{
+    int32_t i = 0;      /* Number of characters appended */
+
+    for (i = 0; i < count; i++)
+    {
+        if (output->length == LIST_OUTPUT_BUFFER_SIZE)
+        {
+            flushListOutput(output);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        output->data[output->length] = character;
+        output->length++;
+    }
+}
+
+/**
+ * @brief Appends a text to the buffer as a JSON string.
+ *
+ * This function escapes the quotes and the backslashes with a backslash and the control characters
+ * with their \u00XX code, the other characters are copied as they are.
+ *
+ * @param output The writer.
+ * @param text The text to be appended.
+ * @param length The number of characters of the text.
+ */
+static void appendJsonString(ListOutput_t *output, const int8_t *text, size_t length)
+{
+    static const char hex_digits[] = "0123456789abcdef";    /* The hexadecimal digits */
+    int8_t escape[6] = {'\\', 'u', '0', '0', '0', '0'};     /* The escape sequence of a control character */
+    size_t start = 0;           /* The first character which is not appended yet */
+    size_t i = 0;               /* Position of each character */
+    uint8_t character = 0;      /* Each character of the text */
+
+    appendRepeated(output, '"', 1);
+    for (i = 0; i < length; i++)
+    {
+        character = (uint8_t)text[i];
+        /* Append the characters before a special character at once, then its escape sequence */
+        if ((character == '"') || (character == '\\'))
+        {
+            appendBytes(output, text + start, i - start);
+            appendRepeated(output, '\\', 1);
+            appendRepeated(output, (int8_t)character, 1);
+            start = i + 1;
+        }
+        else if (character < 0x20u)
+        {
+            appendBytes(output, text + start, i - start);
+            escape[4] = hex_digits[character >> 4];
+            escape[5] = hex_digits[character & 0x0Fu];
+            appendBytes(output, escape, sizeof(escape));
+            start = i + 1;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    appendBytes(output, text + start, length - start);
+    appendRepeated(output, '"', 1);
+}
+
+/**
+ * @brief Gets the number of characters of an ID or an account.
+ *
+ * @param key The ID or the account.
+ * @return The number of characters before the null terminator, at most STUDENT_KEY_SIZE - 1.
+ */
+static size_t getKeyLength(const int8_t *key)
+{
+    const int8_t *end = (const int8_t *)memchr(key, '\0', STUDENT_KEY_SIZE - 1);   /* The null terminator */
+
+    return (end != NULL) ? (size_t)(end - key) : (size_t)(STUDENT_KEY_SIZE - 1);
+}
+
+/**
+ * @brief Formats an average score with two decimals.
+ *
+ * This function gives the same text as "%.2f" of printf. The product of a float by 100 is exact
+ * in a double, so the score is rounded to the nearest hundredth, half to even, and its digits are
+ * written by integer divisions. A score which is not finite or too large is formatted by snprintf.
+ *
+ * @param text A buffer of at least 64 characters which receives the score, without null terminator.
+ * @param average_score The average score.
+ * @return The number of characters of the formatted score.
+ */
+static size_t formatScore(int8_t *text, float average_score)
+{
+    double scaled = (double)average_score * 100.0;     /* The score in hundredths */
+    uint64_t hundredths = 0;        /* The score rounded to hundredths, without sign */
+    uint64_t whole = 0;             /* The integer part of the score, without sign */
+    double remainder = 0.0;         /* The fraction of a hundredth which is rounded */
+    int8_t digits[24];              /* The digits of the integer part, from the last one */
+    int32_t num_digits = 0;         /* The number of digits of the integer part */
+    size_t length = 0;              /* The number of characters of the text */
+    uint32_t bits = 0;              /* The bits of the score, to read its sign */
+
+    /* A score which is not finite or too large for the integer formatting is formatted by snprintf */
+    if (!((scaled > -1e17) && (scaled < 1e17)))
+    {
+        length = (size_t)snprintf((char *)text, 64, "%.2f", average_score);
+    }
+    else
+    {
+        /* Write the sign, printf also writes it for a negative zero */
+        memcpy(&bits, &average_score, sizeof(bits));
+        if ((bits & 0x80000000u) != 0)
+        {
+            text[length] = '-';
+            length++;
+            scaled = -scaled;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        /* Round to the nearest hundredth, half to even */
+        hundredths = (uint64_t)scaled;
+        remainder = scaled - (double)hundredths;
+        if ((remainder > 0.5) || ((remainder == 0.5) && ((hundredths & 1u) != 0)))
+        {
+            hundredths++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        /* Write the integer part from its last digit, then the two decimals */
+        whole = hundredths / 100u;
+        do
+        {
+            digits[num_digits] = (int8_t)('0' + whole % 10u);
+            num_digits++;
+            whole /= 10u;
+        } while (whole > 0);
+        while (num_digits > 0)
+        {
+            num_digits--;
+            text[length] = digits[num_digits];
+            length++;
+        }
+        text[length] = '.';
+        text[length + 1] = (int8_t)('0' + (hundredths / 10u) % 10u);
+        text[length + 2] = (int8_t)('0' + hundredths % 10u);
+        length += 3;
+    }
+    /* Return the number of characters of the score */
+    return length;
+} /* EOF */
@@ -0,0 +1,94 @@
+/**
+ * @file list_output.h
+ * @brief This file contains the function prototypes and data structures for writing the list of students.
+ *
+ * This file contains the function prototypes and data structures of a buffered writer which formats
+ * the records of the students into a large buffer without calling printf, and writes the buffer
+ * to a file descriptor with one call each time it is full.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdio.h>              /* Include standard input and output library for snprintf(), fileno() functions */
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <string.h>             /* For memcpy(), memchr(), strlen() functions */
+#include "manage_students.h"    /* Include header file for the OutputFormat_t type */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef LIST_OUTPUT_H
+#define LIST_OUTPUT_H
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define LIST_OUTPUT_BUFFER_SIZE     1048576     /* The number of bytes of the output buffer */
+#define LIST_OUTPUT_NAME_WIDTH      30          /* The minimum width of the name column of the table */
+#define LIST_OUTPUT_SCORE_WIDTH     13          /* The width of the average score column of the table */
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct ListOutput
+ * @brief This structure represents a buffered writer of records of students.
+ *
+ * Every writer shares the same static buffer, so only one writer may be used at a time.
+ */
+typedef struct ListOutput
+{
+    int fd;                         /* The file descriptor the buffer is written to */
+    OutputFormat_t format;          /* The format of the records */
+    int8_t *data;                   /* The output buffer */
+    size_t length;                  /* The number of bytes in the buffer */
+    uint64_t num_bytes;             /* The number of bytes written so far */
+    int32_t is_failed;              /* 1 if a write failed, 0 otherwise */
+} ListOutput_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Starts writing records of students to a stream.
+ *
+ * This function flushes the stream, so the records follow what was printed to it before,
+ * then writes the header of the format: the column names of a table or of a CSV file.
+ * The block layout and JSON lines have no header.
+ *
+ * @param output The writer to be started.
+ * @param stream The stream whose file descriptor receives the records.
+ * @param format The format of the records.
+ */
+void beginListOutput(ListOutput_t *output, FILE *stream, OutputFormat_t format);
+
+/**
+ * @brief Writes the record of a student.
+ *
+ * This function formats a record into the buffer, the buffer is written to the file descriptor
+ * each time it is full. The average score is formatted with two decimals like "%.2f" of printf.
+ *
+ * @param output The writer.
+ * @param ID The ID of the student, at most STUDENT_KEY_SIZE - 1 characters are written.
+ * @param name The name of the student.
+ * @param account The account of the student, at most STUDENT_KEY_SIZE - 1 characters are written.
+ * @param average_score The average score of the student.
+ */
+void writeRecordToOutput(ListOutput_t *output, const int8_t *ID, const int8_t *name, const int8_t *account,
+                         float average_score);
+
+/**
+ * @brief Finishes writing records of students.
+ *
+ * This function writes the bytes left in the buffer.
+ *
+ * @param output The writer to be finished.
+ * @return 1 if every byte is written, 0 if a write failed.
+ */
+int32_t endListOutput(ListOutput_t *output);
+
+#endif /* LIST_OUTPUT_H */
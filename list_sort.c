@@ -0,0 +1,1117 @@
+/**
+ * @file list_sort.c
+ * @brief This file contains the function definitions for sorting chains of students.
+ *
+ * The file includes the function definitions of a stable merge sort of a chain of students
+ * and of the sorted views of a chain.
+ * The parallel sort runs its tasks on POSIX threads, or on Windows threads when it is built on Windows.
+ * Every task works on its own part of the chain, or of the arrays of the merges, so the threads never share
+ * a student.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "list_sort.h"          /* Include header file of this function file */
+#ifdef _WIN32
+#include <windows.h>            /* For CreateThread(), WaitForSingleObject() functions */
+#else
+#include <pthread.h>            /* For pthread_create(), pthread_join() functions */
+#endif
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @enum SortTaskType
+ * @brief This enumeration represents the kinds of work of a thread of the parallel sort.
+ */
+typedef enum SortTaskType
+{
+    SORT_TASK_CHAIN = 0,            /* Sort a chain, or merge two chains */
+    SORT_TASK_MERGE,                /* Merge two sorted arrays of students into an array */
+    SORT_TASK_LINK                  /* Link the students of an array into a chain */
+} SortTaskType_t;
+
+/**
+ * @struct SortTask
+ * @brief This structure represents the work of one thread of the parallel sort.
+ *
+ * A chain task sorts the chain starting at first if second is NULL, otherwise it merges the sorted chain
+ * starting at first with the sorted chain starting at second. A merge task merges the arrays left and right
+ * into output. A link task links the students of left into a chain which continues with second.
+ */
+typedef struct SortTask
+{
+    SortTaskType_t type;            /* The kind of work of the task */
+    Student_t *first;               /* The first student of the chain to be sorted, or of the left chain to be merged */
+    Student_t *second;              /* The first student of the right chain to be merged, NULL to sort,
+                                       or the student after the linked students */
+    StudentCompare_t compare;       /* The function which compares two students */
+    Student_t *const *left;         /* The left students to be merged, or the students to be linked */
+    int32_t left_count;             /* The number of students of left */
+    Student_t *const *right;        /* The right students to be merged */
+    int32_t right_count;            /* The number of students of right */
+    Student_t **output;             /* The array receiving the merged students, or the students of the sorted chain,
+                                       NULL if a sorted chain is not copied */
+    Student_t *result_first;        /* The first student of the resulting chain */
+    Student_t *result_last;         /* The last student of the resulting chain */
+} SortTask_t;
+
+/**
+ * @struct ScoreKey
+ * @brief This structure represents a student and its key in the radix sort.
+ */
+typedef struct ScoreKey
+{
+    uint32_t key;                   /* The encoded average score, in descending order of the scores */
+    Student_t *student;             /* The student */
+} ScoreKey_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Encodes an average score into a radix key.
+ *
+ * @param average_score The average score.
+ * @return An unsigned integer which is smaller for a higher average score.
+ */
+static uint32_t encodeScoreKey(float average_score);
+
+/**
+ * @brief Sorts radix keys by ascending key.
+ *
+ * @param keys The keys to be sorted.
+ * @param sorted An array of the same number of keys, used as the destination of each pass.
+ * @param count The number of keys, at least 1.
+ * @return keys or sorted, whichever holds the sorted keys after the last pass.
+ */
+static ScoreKey_t *radixSortScoreKeys(ScoreKey_t *keys, ScoreKey_t *sorted, int32_t count);
+
+/**
+ * @brief Grows the array of a sorted view so it can hold a number of students.
+ *
+ * @param view The view.
+ * @param count The number of students the array has to hold.
+ * @return 1 if the array can hold the students, 0 if the memory cannot be allocated.
+ */
+static int32_t growSortedView(SortedView_t *view, int32_t count);
+
+/**
+ * @brief Merges two sorted chains of students.
+ *
+ * @param left The first student of the left chain.
+ * @param right The first student of the right chain.
+ * @param compare The function which compares two students.
+ * @param last Pointer to a variable which receives the last student of the merged chain.
+ * @return The first student of the merged chain.
+ */
+static Student_t *mergeStudentChains(Student_t *left, Student_t *right, StudentCompare_t compare, Student_t **last);
+
+/**
+ * @brief Finds how many students of the left array are among the first students of a merge.
+ *
+ * @param left The left sorted array.
+ * @param left_count The number of students of left.
+ * @param right The right sorted array.
+ * @param right_count The number of students of right.
+ * @param rank The number of first students of the merge.
+ * @param compare The function which compares two students.
+ * @return The number of students of left among the first rank students of the merge.
+ */
+static int32_t findMergeRank(Student_t *const *left, int32_t left_count, Student_t *const *right, int32_t right_count,
+                             int32_t rank, StudentCompare_t compare);
+
+/**
+ * @brief Merges sorted segments of students in arrays and links them into a chain.
+ *
+ * @param tasks The tasks of the sort, one per thread.
+ * @param sorted The students of the sorted segments, one after the other.
+ * @param merged An array of the same number of students, receiving the merges of each round.
+ * @param bounds The position of the first student of each segment, then the number of students.
+ * @param num_segments The number of segments, which is also the number of threads.
+ * @param compare The function which compares two students.
+ * @param last Pointer to a variable which receives the last student of the chain.
+ * @return The first student of the chain.
+ */
+static Student_t *mergeSortedSegments(SortTask_t *tasks, Student_t **sorted, Student_t **merged, int32_t *bounds,
+                                      int32_t num_segments, StudentCompare_t compare, Student_t **last);
+
+/**
+ * @brief Runs one task of the parallel sort.
+ *
+ * @param task The task to be run.
+ */
+static void runSortTask(SortTask_t *task);
+
+/**
+ * @brief Runs tasks of the parallel sort at the same time.
+ *
+ * @param tasks The tasks to be run.
+ * @param num_tasks The number of tasks.
+ */
+static void runSortTasks(SortTask_t *tasks, int32_t num_tasks);
+
+#ifdef _WIN32
+/**
+ * @brief Runs a task of the parallel sort on a new thread.
+ *
+ * @param arg The task to be run.
+ * @return Always 0.
+ */
+static DWORD WINAPI sortThreadMain(LPVOID arg);
+#else
+/**
+ * @brief Runs a task of the parallel sort on a new thread.
+ *
+ * @param arg The task to be run.
+ * @return Always NULL.
+ */
+static void *sortThreadMain(void *arg);
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Sorts a chain of students on the calling thread.
+ *
+ * This function sorts a chain of students with a stable bottom-up merge sort.
+ * Each pass merges neighbouring runs of the chain which double in width, by relinking the next pointers
+ * of the students only, so no data of the students is copied.
+ *
+ * @param first The first student of the chain, the chain ends with a NULL next pointer.
+ * @param compare The function which compares two students.
+ * @param last Pointer to a variable which receives the last student of the sorted chain.
+ * @return The first student of the sorted chain.
+ */
+Student_t *sortStudentChain(Student_t *first, StudentCompare_t compare, Student_t **last)
+{
+    Student_t *list = first;                /* The list which is being merged in this pass */
+    Student_t *merged_tail = first;         /* The last student of the merged list of this pass */
+    Student_t *left = NULL;                 /* The current student of the left run */
+    Student_t *right = NULL;                /* The current student of the right run */
+    Student_t *chosen = NULL;               /* The student which is moved to the merged list */
+    int32_t width = 1;                      /* The width of the runs to be merged in this pass */
+    int32_t num_merges = 0;                 /* The number of merges done in this pass */
+    int32_t left_size = 0;                  /* The number of students left in the left run */
+    int32_t right_size = 0;                 /* The number of students left in the right run */
+
+    /* A chain of less than two students is already sorted */
+    if ((first != NULL) && (first->next != NULL))
+    {
+        /* Merge runs of doubling width until only one merge is done in a pass */
+        do
+        {
+            left = list;
+            list = NULL;
+            merged_tail = NULL;
+            num_merges = 0;
+
+            /* Merge every pair of neighbouring runs */
+            while (left != NULL)
+            {
+                num_merges++;
+
+                /* Step over the left run to find the start of the right run */
+                right = left;
+                left_size = 0;
+                while ((left_size < width) && (right != NULL))
+                {
+                    left_size++;
+                    right = right->next;
+                }
+                right_size = width;
+
+                /* Merge the two runs, taking the left student first when they are equal */
+                while ((left_size > 0) || ((right_size > 0) && (right != NULL)))
+                {
+                    if (left_size == 0)
+                    {
+                        chosen = right;
+                        right = right->next;
+                        right_size--;
+                    }
+                    else if ((right_size == 0) || (right == NULL) || (compare(left, right) <= 0))
+                    {
+                        chosen = left;
+                        left = left->next;
+                        left_size--;
+                    }
+                    else
+                    {
+                        chosen = right;
+                        right = right->next;
+                        right_size--;
+                    }
+
+                    /* Append the chosen student to the merged list */
+                    if (merged_tail == NULL)
+                    {
+                        list = chosen;
+                    }
+                    else
+                    {
+                        merged_tail->next = chosen;
+                    }
+                    merged_tail = chosen;
+                }
+                /* The next left run starts after the right run */
+                left = right;
+            }
+            merged_tail->next = NULL;
+            /* Double the width of the runs */
+            width *= 2;
+        }
+        while (num_merges > 1);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the first and the last student of the sorted chain */
+    *last = merged_tail;
+    return list;
+}
+
+/**
+ * @brief Sorts a chain of students on several threads.
+ *
+ * This function cuts the chain into one segment per thread and sorts every segment on its own thread
+ * with sortStudentChain, which also copies it into an array. The sorted segments are then merged pairwise
+ * until one array is left. Every round keeps all the threads busy, up to the final merge: each merge is
+ * split into as many parts as it has threads, the bounds of each part being found by a binary search of
+ * its first rank in both segments, and each part is merged on its own thread. The array is linked into
+ * a chain on every thread at the end. If the memory of the arrays cannot be allocated, the chains are
+ * merged pairwise instead, the merges of a round running on separate threads, so the final merge is serial.
+ * The sort is stable because a segment is always merged with the segment which follows it, taking
+ * the student of the first segment when they are equal.
+ * Fewer threads are used when a segment would have less than LIST_SORT_MIN_SEGMENT students, so a small
+ * chain is sorted on the calling thread.
+ * The compare function is called from several threads at once and must not modify any shared data.
+ *
+ * @param first The first student of the chain, the chain ends with a NULL next pointer.
+ * @param count The number of students of the chain.
+ * @param compare The function which compares two students.
+ * @param num_threads The number of threads, between 1 and LIST_SORT_MAX_THREADS.
+ * @param last Pointer to a variable which receives the last student of the sorted chain.
+ * @return The first student of the sorted chain.
+ */
+Student_t *sortStudentChainParallel(Student_t *first, int32_t count, StudentCompare_t compare,
+                                    int32_t num_threads, Student_t **last)
+{
+    SortTask_t tasks[LIST_SORT_MAX_THREADS];    /* The tasks of the current round */
+    Student_t *segments[LIST_SORT_MAX_THREADS]; /* The first student of each sorted segment */
+    Student_t *ends[LIST_SORT_MAX_THREADS];     /* The last student of each sorted segment */
+    int32_t bounds[LIST_SORT_MAX_THREADS + 1];  /* The position of the first student of each segment in the arrays */
+    Student_t **sorted = NULL;                  /* The students of the sorted segments, one after the other */
+    Student_t **merged = NULL;                  /* The array receiving the merges of each round */
+    Student_t *temp = first;                    /* Temporary pointer to walk over a segment */
+    int32_t num_segments = num_threads;         /* The number of segments */
+    int32_t num_tasks = 0;                      /* The number of tasks of the current round */
+    int32_t segment_size = 0;                   /* The number of students of each segment */
+    int32_t i = 0;                              /* Position of each segment */
+    int32_t j = 0;                              /* Position of each student of a segment */
+
+    /* Keep every segment large enough to be worth a thread */
+    num_segments = (num_segments > LIST_SORT_MAX_THREADS) ? LIST_SORT_MAX_THREADS : num_segments;
+    num_segments = (num_segments > (count / LIST_SORT_MIN_SEGMENT)) ? (count / LIST_SORT_MIN_SEGMENT) : num_segments;
+
+    /* A small chain is sorted on the calling thread */
+    if (num_segments < 2)
+    {
+        first = sortStudentChain(first, compare, last);
+    }
+    else
+    {
+        /* The segments are merged in arrays, or as chains if the memory of the arrays cannot be allocated */
+        sorted = (Student_t **)malloc((size_t)count * sizeof(Student_t *));
+        merged = (Student_t **)malloc((size_t)count * sizeof(Student_t *));
+        if ((sorted == NULL) || (merged == NULL))
+        {
+            free(sorted);
+            free(merged);
+            sorted = NULL;
+            merged = NULL;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        /* Cut the chain into segments, the last segment takes the remaining students */
+        segment_size = count / num_segments;
+        for (i = 0; i < num_segments; i++)
+        {
+            tasks[i].type = SORT_TASK_CHAIN;
+            tasks[i].first = temp;
+            tasks[i].second = NULL;
+            tasks[i].compare = compare;
+            tasks[i].output = (sorted != NULL) ? &sorted[i * segment_size] : NULL;
+            bounds[i] = i * segment_size;
+            for (j = 1; (j < segment_size) && (i < (num_segments - 1)); j++)
+            {
+                temp = temp->next;
+            }
+            if (i < (num_segments - 1))
+            {
+                tasks[i].result_last = temp;
+                temp = temp->next;
+                tasks[i].result_last->next = NULL;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+
+        bounds[num_segments] = count;
+
+        /* Sort every segment on its own thread */
+        runSortTasks(tasks, num_segments);
+        for (i = 0; i < num_segments; i++)
+        {
+            segments[i] = tasks[i].result_first;
+            ends[i] = tasks[i].result_last;
+        }
+
+        /* Merge the arrays of the segments on every thread */
+        if (sorted != NULL)
+        {
+            first = mergeSortedSegments(tasks, sorted, merged, bounds, num_segments, compare, last);
+            num_segments = 1;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        /* Otherwise merge neighbouring segments pairwise until one chain is left */
+        while (num_segments > 1)
+        {
+            num_tasks = num_segments / 2;
+            for (i = 0; i < num_tasks; i++)
+            {
+                tasks[i].first = segments[2 * i];
+                tasks[i].second = segments[(2 * i) + 1];
+                tasks[i].compare = compare;
+            }
+            runSortTasks(tasks, num_tasks);
+            for (i = 0; i < num_tasks; i++)
+            {
+                segments[i] = tasks[i].result_first;
+                ends[i] = tasks[i].result_last;
+            }
+            /* An odd segment is carried to the next round */
+            if ((num_segments % 2) != 0)
+            {
+                segments[num_tasks] = segments[num_segments - 1];
+                ends[num_tasks] = ends[num_segments - 1];
+                num_tasks++;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            num_segments = num_tasks;
+            first = segments[0];
+            *last = ends[0];
+        }
+        free(sorted);
+        free(merged);
+    }
+    /* Return the first student of the sorted chain */
+    return first;
+}
+
+/**
+ * @brief Sorts a chain of students by descending average score with a radix sort.
+ *
+ * This function encodes every average score into an unsigned integer whose order is the descending order
+ * of the scores, then sorts the pairs of keys and students with a stable LSD radix sort of four 8-bit digits.
+ * A digit which is the same for every student is skipped, so scores of a narrow range take fewer passes.
+ * The chain is relinked in the sorted order, students having the same average score keep their order.
+ * The chain is merge sorted with compare instead if the memory of the keys cannot be allocated.
+ *
+ * @param first The first student of the chain, the chain ends with a NULL next pointer.
+ * @param count The number of students of the chain.
+ * @param compare The function which compares two students by descending average score.
+ * @param last Pointer to a variable which receives the last student of the sorted chain.
+ * @return The first student of the sorted chain.
+ */
+Student_t *sortStudentChainByScore(Student_t *first, int32_t count, StudentCompare_t compare, Student_t **last)
+{
+    ScoreKey_t *keys = (ScoreKey_t *)malloc((size_t)count * sizeof(ScoreKey_t));      /* The keys in the order of the chain */
+    ScoreKey_t *sorted = (ScoreKey_t *)malloc((size_t)count * sizeof(ScoreKey_t));    /* The second array of keys of the radix sort */
+    ScoreKey_t *result = NULL;                  /* The array holding the sorted keys */
+    Student_t *temp = first;                    /* Temporary pointer to traverse the chain */
+    int32_t i = 0;                              /* Position of each key */
+
+    /* A chain of less than two students is already sorted, without memory it is merge sorted */
+    if ((count < 2) || (keys == NULL) || (sorted == NULL))
+    {
+        first = sortStudentChain(first, compare, last);
+    }
+    else
+    {
+        /* Encode the keys in one traversal */
+        for (i = 0; i < count; i++)
+        {
+            keys[i].key = encodeScoreKey(temp->average_score);
+            keys[i].student = temp;
+            temp = temp->next;
+        }
+        result = radixSortScoreKeys(keys, sorted, count);
+
+        /* Relink the chain in the sorted order */
+        for (i = 0; i < (count - 1); i++)
+        {
+            result[i].student->next = result[i + 1].student;
+        }
+        result[count - 1].student->next = NULL;
+        first = result[0].student;
+        *last = result[count - 1].student;
+    }
+    free(keys);
+    free(sorted);
+    /* Return the first student of the sorted chain */
+    return first;
+}
+
+/**
+ * @brief Sorts the score column and the student column of a list by descending average score.
+ *
+ * This function encodes the keys from the score column only, so no student is read before the keys
+ * are sorted, sorts them with the stable radix sort of sortStudentChainByScore, then rewrites both columns
+ * in the sorted order and relinks the students.
+ * The columns are left unchanged if the memory of the keys cannot be allocated.
+ *
+ * @param scores The average score of each row.
+ * @param students The student of each row.
+ * @param count The number of rows, at least 1.
+ * @param last Pointer to a variable which receives the last student of the sorted chain.
+ * @return The first student of the sorted chain, NULL if the memory of the keys cannot be allocated.
+ */
+Student_t *sortStudentColumnsByScore(float *scores, Student_t **students, int32_t count, Student_t **last)
+{
+    ScoreKey_t *keys = (ScoreKey_t *)malloc((size_t)count * sizeof(ScoreKey_t));      /* The keys in the order of the rows */
+    ScoreKey_t *sorted = (ScoreKey_t *)malloc((size_t)count * sizeof(ScoreKey_t));    /* The second array of keys of the radix sort */
+    ScoreKey_t *result = NULL;                  /* The array holding the sorted keys */
+    Student_t *first = NULL;                    /* The first student of the sorted chain */
+    int32_t i = 0;                              /* Position of each row */
+
+    if ((keys != NULL) && (sorted != NULL))
+    {
+        /* Encode the keys from the score column */
+        for (i = 0; i < count; i++)
+        {
+            keys[i].key = encodeScoreKey(scores[i]);
+            keys[i].student = students[i];
+        }
+        result = radixSortScoreKeys(keys, sorted, count);
+
+        /* Rewrite the columns and relink the chain in the sorted order */
+        for (i = 0; i < count; i++)
+        {
+            students[i] = result[i].student;
+            scores[i] = result[i].student->average_score;
+            result[i].student->next = (i < (count - 1)) ? result[i + 1].student : NULL;
+        }
+        first = students[0];
+        *last = students[count - 1];
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    free(keys);
+    free(sorted);
+    /* Return the first student of the sorted chain */
+    return first;
+}
+
+/**
+ * @brief Fills a sorted view with the order of a chain of students.
+ *
+ * This function grows the array of the view if it cannot hold every student of the chain, then copies
+ * the students in the order of the chain. The view is invalid if the array cannot be grown.
+ *
+ * @param view The view to be filled.
+ * @param first The first student of the chain, the chain ends with a NULL next pointer.
+ * @param count The number of students of the chain.
+ * @return 1 if the view is valid, 0 if the memory of the array cannot be allocated.
+ */
+int32_t fillSortedView(SortedView_t *view, Student_t *first, int32_t count)
+{
+    Student_t *temp = first;            /* Temporary pointer to traverse the chain */
+    int32_t i = 0;                      /* Position of each student */
+
+    view->is_valid = 0;
+    view->is_tie_free = 0;
+    /* Copy the students in the order of the chain */
+    if (growSortedView(view, count))
+    {
+        for (i = 0; i < count; i++)
+        {
+            view->students[i] = temp;
+            temp = temp->next;
+        }
+        view->count = count;
+        view->is_valid = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return whether the view is valid */
+    return view->is_valid;
+}
+
+/**
+ * @brief Fills a sorted view with an array of students.
+ *
+ * This function grows the array of the view like fillSortedView, then copies the students at once.
+ *
+ * @param view The view to be filled.
+ * @param students The students in the sorted order.
+ * @param count The number of students.
+ * @return 1 if the view is valid, 0 if the memory of the array cannot be allocated.
+ */
+int32_t copySortedView(SortedView_t *view, Student_t *const *students, int32_t count)
+{
+    view->is_valid = 0;
+    view->is_tie_free = 0;
+    /* Copy the students at once */
+    if (growSortedView(view, count))
+    {
+        memcpy(view->students, students, (size_t)count * sizeof(Student_t *));
+        view->count = count;
+        view->is_valid = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return whether the view is valid */
+    return view->is_valid;
+}
+
+/**
+ * @brief Relinks the students of a sorted view into a chain.
+ *
+ * This function sets the next pointer of every student of the view to the student after it.
+ * The view must be valid and not empty.
+ *
+ * @param view The view to be linked.
+ * @param last Pointer to a variable which receives the last student of the chain.
+ * @return The first student of the chain.
+ */
+Student_t *linkSortedView(const SortedView_t *view, Student_t **last)
+{
+    int32_t i = 0;      /* Position of each student */
+
+    /* Link every student to the student after it in the view */
+    for (i = 0; i < (view->count - 1); i++)
+    {
+        view->students[i]->next = view->students[i + 1];
+    }
+    view->students[view->count - 1]->next = NULL;
+    *last = view->students[view->count - 1];
+    /* Return the first student of the chain */
+    return view->students[0];
+}
+
+/**
+ * @brief Checks if two students of a sorted view have the same key.
+ *
+ * This function stops at the first two adjacent students which compare equal, since the view is sorted
+ * the students having the same key are next to each other.
+ *
+ * @param view The view to be checked.
+ * @param compare The function which compares two students in the order of the view.
+ */
+void markSortedViewTies(SortedView_t *view, StudentCompare_t compare)
+{
+    int32_t i = 0;      /* Position of each student */
+
+    view->is_tie_free = view->is_valid;
+    for (i = 1; (i < view->count) && view->is_tie_free; i++)
+    {
+        if (compare(view->students[i - 1], view->students[i]) == 0)
+        {
+            view->is_tie_free = 0;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/**
+ * @brief Frees the array of a sorted view.
+ *
+ * @param view The view to be freed.
+ */
+void freeSortedView(SortedView_t *view)
+{
+    free(view->students);
+    view->students = NULL;
+    view->count = 0;
+    view->capacity = 0;
+    view->is_valid = 0;
+    view->is_tie_free = 0;
+}
+
+/**
+ * @brief Merges two sorted chains of students.
+ *
+ * This function relinks the students of both chains into one chain, taking the student of the left chain
+ * first when two students are equal.
+ *
+ * @param left The first student of the left chain.
+ * @param right The first student of the right chain.
+ * @param compare The function which compares two students.
+ * @param last Pointer to a variable which receives the last student of the merged chain.
+ * @return The first student of the merged chain.
+ */
+static Student_t *mergeStudentChains(Student_t *left, Student_t *right, StudentCompare_t compare, Student_t **last)
+{
+    Student_t head;                 /* Dummy student placed before the merged chain */
+    Student_t *tail = &head;        /* The last student of the merged chain */
+
+    /* Move the smaller student of both chains to the merged chain */
+    while ((left != NULL) && (right != NULL))
+    {
+        if (compare(left, right) <= 0)
+        {
+            tail->next = left;
+            left = left->next;
+        }
+        else
+        {
+            tail->next = right;
+            right = right->next;
+        }
+        tail = tail->next;
+    }
+    /* Append the rest of the chain which is not empty */
+    tail->next = (left != NULL) ? left : right;
+    while (tail->next != NULL)
+    {
+        tail = tail->next;
+    }
+    /* Return the first and the last student of the merged chain */
+    *last = tail;
+    return head.next;
+}
+
+/**
+ * @brief Finds how many students of the left array are among the first students of a merge.
+ *
+ * This function searches the number i of students of left such that the first i students of left and
+ * the first rank - i students of right are the first rank students of the stable merge of both arrays,
+ * which takes the student of left when two students are equal. It compares O(log rank) students.
+ *
+ * @param left The left sorted array.
+ * @param left_count The number of students of left.
+ * @param right The right sorted array.
+ * @param right_count The number of students of right.
+ * @param rank The number of first students of the merge.
+ * @param compare The function which compares two students.
+ * @return The number of students of left among the first rank students of the merge.
+ */
+static int32_t findMergeRank(Student_t *const *left, int32_t left_count, Student_t *const *right, int32_t right_count,
+                             int32_t rank, StudentCompare_t compare)
+{
+    int32_t low = (rank > right_count) ? (rank - right_count) : 0;     /* The lowest possible number */
+    int32_t high = (rank < left_count) ? rank : left_count;             /* The highest possible number */
+    int32_t middle = 0;                 /* The number checked by each step */
+
+    while (low < high)
+    {
+        middle = low + ((high - low) / 2);
+        /* If left[middle] is merged before right[rank - middle - 1], more students of left are taken */
+        if (compare(left[middle], right[rank - middle - 1]) <= 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    /* Return the number of students of left */
+    return low;
+}
+
+/**
+ * @brief Merges sorted segments of students in arrays and links them into a chain.
+ *
+ * This function merges neighbouring segments pairwise, from sorted into merged and back, until one segment
+ * is left. Each round splits every merge into as many parts as the threads divided by the merges of the round,
+ * an odd segment being copied by one task, so the final merge runs on every thread. The students of the last
+ * array are then linked on every thread, each one linking its part to the first student of the next part.
+ *
+ * @param tasks The tasks of the sort, one per thread.
+ * @param sorted The students of the sorted segments, one after the other.
+ * @param merged An array of the same number of students, receiving the merges of each round.
+ * @param bounds The position of the first student of each segment, then the number of students.
+ * @param num_segments The number of segments, which is also the number of threads.
+ * @param compare The function which compares two students.
+ * @param last Pointer to a variable which receives the last student of the chain.
+ * @return The first student of the chain.
+ */
+static Student_t *mergeSortedSegments(SortTask_t *tasks, Student_t **sorted, Student_t **merged, int32_t *bounds,
+                                      int32_t num_segments, StudentCompare_t compare, Student_t **last)
+{
+    int32_t num_threads = num_segments;         /* The number of tasks of each round */
+    int32_t count = bounds[num_segments];       /* The number of students */
+    Student_t **swapped = NULL;                 /* Temporary pointer to swap the arrays after each round */
+    Student_t *const *left = NULL;              /* The left segment of each merge */
+    Student_t *const *right = NULL;             /* The right segment of each merge */
+    int32_t left_count = 0;                     /* The number of students of the left segment */
+    int32_t right_count = 0;                    /* The number of students of the right segment */
+    int32_t num_outputs = 0;                    /* The number of segments after the round */
+    int32_t num_parts = 0;                      /* The number of parts of each merge of the round */
+    int32_t num_tasks = 0;                      /* The number of tasks of the round */
+    int32_t start = 0;                          /* The first rank of each part */
+    int32_t end = 0;                            /* The rank after each part */
+    int32_t left_start = 0;                     /* The students of left before each part */
+    int32_t left_end = 0;                       /* The students of left before the next part */
+    int32_t i = 0;                              /* Position of each merge */
+    int32_t j = 0;                              /* Position of each part of a merge */
+
+    while (num_segments > 1)
+    {
+        num_outputs = (num_segments + 1) / 2;
+        num_parts = num_threads / num_outputs;
+        num_tasks = 0;
+        for (i = 0; i < num_outputs; i++)
+        {
+            /* The right segment of an odd segment is empty, so the segment is copied */
+            left = &sorted[bounds[2 * i]];
+            left_count = bounds[(2 * i) + 1] - bounds[2 * i];
+            right = &sorted[bounds[(2 * i) + 1]];
+            right_count = (((2 * i) + 1) < num_segments) ? (bounds[(2 * i) + 2] - bounds[(2 * i) + 1]) : 0;
+            for (j = 0; j < num_parts; j++)
+            {
+                /* Find the students of both segments merged by the part */
+                start = (int32_t)(((int64_t)(left_count + right_count) * j) / num_parts);
+                end = (int32_t)(((int64_t)(left_count + right_count) * (j + 1)) / num_parts);
+                left_start = findMergeRank(left, left_count, right, right_count, start, compare);
+                left_end = findMergeRank(left, left_count, right, right_count, end, compare);
+                tasks[num_tasks].type = SORT_TASK_MERGE;
+                tasks[num_tasks].compare = compare;
+                tasks[num_tasks].left = &left[left_start];
+                tasks[num_tasks].left_count = left_end - left_start;
+                tasks[num_tasks].right = &right[start - left_start];
+                tasks[num_tasks].right_count = (end - left_end) - (start - left_start);
+                tasks[num_tasks].output = &merged[bounds[2 * i] + start];
+                num_tasks++;
+            }
+            /* The merged segment starts where its left segment started */
+            bounds[i] = bounds[2 * i];
+        }
+        bounds[num_outputs] = count;
+        runSortTasks(tasks, num_tasks);
+
+        /* The merged segments are sorted for the next round */
+        swapped = sorted;
+        sorted = merged;
+        merged = swapped;
+        num_segments = num_outputs;
+    }
+
+    /* Link the students on every thread, each part continues with the first student of the next part */
+    for (i = 0; i < num_threads; i++)
+    {
+        start = (int32_t)(((int64_t)count * i) / num_threads);
+        end = (int32_t)(((int64_t)count * (i + 1)) / num_threads);
+        tasks[i].type = SORT_TASK_LINK;
+        tasks[i].left = &sorted[start];
+        tasks[i].left_count = end - start;
+        tasks[i].second = (end < count) ? sorted[end] : NULL;
+    }
+    runSortTasks(tasks, num_threads);
+    /* Return the first and the last student of the chain */
+    *last = sorted[count - 1];
+    return sorted[0];
+}
+
+/**
+ * @brief Runs one task of the parallel sort.
+ *
+ * A chain task copies its sorted chain into its output if it has one. A merge task takes the student of left
+ * when two students are equal, like mergeStudentChains.
+ *
+ * @param task The task to be run.
+ */
+static void runSortTask(SortTask_t *task)
+{
+    Student_t *temp = NULL;         /* Temporary pointer to walk over the sorted chain */
+    int32_t i = 0;                  /* Position of each student of left */
+    int32_t j = 0;                  /* Position of each student of right */
+
+    /* Sort the chain, or merge the two chains */
+    if ((task->type == SORT_TASK_CHAIN) && (task->second == NULL))
+    {
+        task->result_first = sortStudentChain(task->first, task->compare, &task->result_last);
+        /* Copy the sorted chain into the array of the merges */
+        for (temp = task->result_first; (temp != NULL) && (task->output != NULL); temp = temp->next)
+        {
+            task->output[i] = temp;
+            i++;
+        }
+    }
+    else if (task->type == SORT_TASK_CHAIN)
+    {
+        task->result_first = mergeStudentChains(task->first, task->second, task->compare, &task->result_last);
+    }
+    /* Merge the two arrays */
+    else if (task->type == SORT_TASK_MERGE)
+    {
+        while ((i < task->left_count) && (j < task->right_count))
+        {
+            if (task->compare(task->left[i], task->right[j]) <= 0)
+            {
+                task->output[i + j] = task->left[i];
+                i++;
+            }
+            else
+            {
+                task->output[i + j] = task->right[j];
+                j++;
+            }
+        }
+        /* Copy the rest of the array which is not empty */
+        memcpy(&task->output[i + j], &task->left[i], (size_t)(task->left_count - i) * sizeof(Student_t *));
+        memcpy(&task->output[task->left_count + j], &task->right[j], (size_t)(task->right_count - j) * sizeof(Student_t *));
+    }
+    /* Link the students of the array */
+    else
+    {
+        for (i = 0; i < (task->left_count - 1); i++)
+        {
+            task->left[i]->next = task->left[i + 1];
+        }
+        if (task->left_count > 0)
+        {
+            task->left[task->left_count - 1]->next = task->second;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/**
+ * @brief Runs tasks of the parallel sort at the same time.
+ *
+ * This function starts one thread per task except the first one, which is run on the calling thread,
+ * and waits for every thread. A task whose thread cannot be started is run on the calling thread.
+ *
+ * @param tasks The tasks to be run.
+ * @param num_tasks The number of tasks.
+ */
+static void runSortTasks(SortTask_t *tasks, int32_t num_tasks)
+{
+#ifdef _WIN32
+    HANDLE threads[LIST_SORT_MAX_THREADS];      /* The threads of the tasks */
+#else
+    pthread_t threads[LIST_SORT_MAX_THREADS];   /* The threads of the tasks */
+#endif
+    int32_t is_started[LIST_SORT_MAX_THREADS];  /* 1 if the thread of the task is started */
+    int32_t i = 0;                              /* Position of each task */
+
+    /* Start a thread for every task but the first one */
+    for (i = 1; i < num_tasks; i++)
+    {
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, sortThreadMain, &tasks[i], 0, NULL);
+        is_started[i] = (threads[i] != NULL) ? 1 : 0;
+#else
+        is_started[i] = (pthread_create(&threads[i], NULL, sortThreadMain, &tasks[i]) == 0) ? 1 : 0;
+#endif
+    }
+    /* Run the first task on the calling thread */
+    runSortTask(&tasks[0]);
+
+    /* Wait for every thread, run the tasks whose thread is not started */
+    for (i = 1; i < num_tasks; i++)
+    {
+        if (is_started[i])
+        {
+#ifdef _WIN32
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        }
+        else
+        {
+            runSortTask(&tasks[i]);
+        }
+    }
+}
+
+/**
+ * @brief Sorts radix keys by ascending key.
+ *
+ * This function counts the values of the four 8-bit digits of the keys in one pass, then distributes
+ * the keys digit by digit from the lowest one between the two arrays, keeping the order of equal digits,
+ * so the sort is stable. A digit which is the same for every key is skipped.
+ *
+ * @param keys The keys to be sorted.
+ * @param sorted An array of the same number of keys, used as the destination of each pass.
+ * @param count The number of keys, at least 1.
+ * @return keys or sorted, whichever holds the sorted keys after the last pass.
+ */
+static ScoreKey_t *radixSortScoreKeys(ScoreKey_t *keys, ScoreKey_t *sorted, int32_t count)
+{
+    ScoreKey_t *swap = NULL;                    /* Temporary pointer to swap the arrays */
+    uint32_t counts[LIST_SORT_RADIX_PASSES][LIST_SORT_RADIX_SIZE];  /* The number of keys having each value of each digit */
+    uint32_t offset = 0;                        /* The position of the next key having a value of the digit */
+    uint32_t digit = 0;                         /* The value of the digit of a key */
+    uint32_t num_keys = 0;                      /* The number of keys having a value of the digit */
+    int32_t pass = 0;                           /* Index of each digit, from the lowest one */
+    int32_t i = 0;                              /* Position of each key */
+    int32_t value = 0;                          /* Each value of a digit */
+
+    /* Count the values of every digit in one pass */
+    memset(counts, 0, sizeof(counts));
+    for (i = 0; i < count; i++)
+    {
+        for (pass = 0; pass < LIST_SORT_RADIX_PASSES; pass++)
+        {
+            counts[pass][(keys[i].key >> (pass * LIST_SORT_RADIX_BITS)) & (LIST_SORT_RADIX_SIZE - 1)]++;
+        }
+    }
+
+    /* Distribute the keys digit by digit from the lowest one, keeping the order of equal digits */
+    for (pass = 0; pass < LIST_SORT_RADIX_PASSES; pass++)
+    {
+        digit = (keys[0].key >> (pass * LIST_SORT_RADIX_BITS)) & (LIST_SORT_RADIX_SIZE - 1);
+        /* Skip the digit if every key has the same value */
+        if (counts[pass][digit] != (uint32_t)count)
+        {
+            /* Turn the counts into the start position of each value */
+            offset = 0;
+            for (value = 0; value < LIST_SORT_RADIX_SIZE; value++)
+            {
+                num_keys = counts[pass][value];
+                counts[pass][value] = offset;
+                offset += num_keys;
+            }
+            for (i = 0; i < count; i++)
+            {
+                digit = (keys[i].key >> (pass * LIST_SORT_RADIX_BITS)) & (LIST_SORT_RADIX_SIZE - 1);
+                sorted[counts[pass][digit]] = keys[i];
+                counts[pass][digit]++;
+            }
+            swap = keys;
+            keys = sorted;
+            sorted = swap;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    /* Return the array holding the sorted keys */
+    return keys;
+}
+
+/**
+ * @brief Grows the array of a sorted view so it can hold a number of students.
+ *
+ * The array only grows, so refilling a view of the same list allocates no memory.
+ *
+ * @param view The view.
+ * @param count The number of students the array has to hold.
+ * @return 1 if the array can hold the students, 0 if the memory cannot be allocated.
+ */
+static int32_t growSortedView(SortedView_t *view, int32_t count)
+{
+    Student_t **students = NULL;        /* The grown array of students */
+
+    if (count > view->capacity)
+    {
+        students = (Student_t **)realloc(view->students, (size_t)count * sizeof(Student_t *));
+        if (students != NULL)
+        {
+            view->students = students;
+            view->capacity = count;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return whether the array can hold the students */
+    return (count <= view->capacity) ? 1 : 0;
+}
+
+/**
+ * @brief Encodes an average score into a radix key.
+ *
+ * This function takes the bits of the float, flips every bit of a negative number and only the sign bit of
+ * a positive number so the unsigned order of the keys is the order of the scores, then inverts the key
+ * for the descending order. Both zeros have the same key.
+ *
+ * @param average_score The average score.
+ * @return An unsigned integer which is smaller for a higher average score.
+ */
+static uint32_t encodeScoreKey(float average_score)
+{
+    uint32_t bits = 0;      /* The bits of the average score */
+
+    /* Store -0 like +0 because they compare equal */
+    if (average_score != 0.0f)
+    {
+        memcpy(&bits, &average_score, sizeof(bits));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    bits = ((bits & 0x80000000u) != 0) ? ~bits : (bits | 0x80000000u);
+    /* Return the key in descending order of the scores */
+    return ~bits;
+}
+
+#ifdef _WIN32
+/**
+ * @brief Runs a task of the parallel sort on a new thread.
+ *
+ * @param arg The task to be run.
+ * @return Always 0.
+ */
+static DWORD WINAPI sortThreadMain(LPVOID arg)
+{
+    runSortTask((SortTask_t *)arg);
+    return 0;
+}
+#else
+/**
+ * @brief Runs a task of the parallel sort on a new thread.
+ *
+ * @param arg The task to be run.
+ * @return Always NULL.
+ */
+static void *sortThreadMain(void *arg)
+{
+    runSortTask((SortTask_t *)arg);
+    return NULL;
+}
+#endif /* EOF */
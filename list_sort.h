@@ -0,0 +1,189 @@
+/**
+ * @file list_sort.h
+ * @brief This file contains the function prototypes for sorting chains of students.
+ *
+ * This file contains the function prototypes of a stable merge sort which sorts a chain of students
+ * linked by their next pointer, on one thread or on several threads, of a radix sort of the chain
+ * by average score, and of the sorted views which keep the order of a sort for later use.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For malloc(), free() functions */
+#include <string.h>             /* For memset(), memcpy() functions */
+#include "manage_students.h"    /* Include header file for the Student_t structure and the StudentCompare_t type */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef LIST_SORT_H
+#define LIST_SORT_H
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define LIST_SORT_MAX_THREADS       64          /* The maximum number of threads of a parallel sort */
+#define LIST_SORT_MIN_SEGMENT       16384       /* The minimum number of students sorted by each thread */
+#define LIST_SORT_RADIX_BITS        8           /* The number of bits of each digit of the radix sort */
+#define LIST_SORT_RADIX_SIZE        256         /* The number of values of each digit of the radix sort */
+#define LIST_SORT_RADIX_PASSES      4           /* The number of digits of the key of the radix sort */
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct SortedView
+ * @brief This structure represents a sorted view of a chain of students.
+ *
+ * This structure keeps the students of a chain in the order of a sort, so the chain can be relinked
+ * in that order again without comparing any student. The view is only valid while no student is added
+ * to or deleted from the chain. Relinking it is only the same as a stable sort of the chain when no two
+ * students of the view have the same key, which is kept in is_tie_free.
+ */
+typedef struct SortedView
+{
+    Student_t **students;           /* The students in the sorted order */
+    int32_t count;                  /* The number of students of the view */
+    int32_t capacity;               /* The number of students the array can hold */
+    int32_t is_valid;               /* 1 if the view matches the chain, 0 otherwise */
+    int32_t is_tie_free;            /* 1 if no two students of the view have the same key, 0 otherwise */
+} SortedView_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Sorts a chain of students on the calling thread.
+ *
+ * This function sorts a chain of students with a stable bottom-up merge sort.
+ * Each pass merges neighbouring runs of the chain which double in width, by relinking the next pointers
+ * of the students only, so no data of the students is copied.
+ *
+ * @param first The first student of the chain, the chain ends with a NULL next pointer.
+ * @param compare The function which compares two students.
+ * @param last Pointer to a variable which receives the last student of the sorted chain.
+ * @return The first student of the sorted chain.
+ */
+Student_t *sortStudentChain(Student_t *first, StudentCompare_t compare, Student_t **last);
+
+/**
+ * @brief Sorts a chain of students on several threads.
+ *
+ * This function cuts the chain into one segment per thread and sorts every segment on its own thread
+ * with sortStudentChain. The sorted segments are then merged pairwise in arrays until one is left, every merge
+ * being split into parts at the ranks found by a binary search so each round, the final merge included,
+ * runs on every thread. The array is then linked into a chain on every thread. If the memory of the arrays
+ * cannot be allocated, the chains are merged pairwise instead and the final merge runs on one thread.
+ * The sort is stable.
+ * Fewer threads are used when a segment would have less than LIST_SORT_MIN_SEGMENT students, so a small
+ * chain is sorted on the calling thread.
+ * The compare function is called from several threads at once and must not modify any shared data.
+ *
+ * @param first The first student of the chain, the chain ends with a NULL next pointer.
+ * @param count The number of students of the chain.
+ * @param compare The function which compares two students.
+ * @param num_threads The number of threads, between 1 and LIST_SORT_MAX_THREADS.
+ * @param last Pointer to a variable which receives the last student of the sorted chain.
+ * @return The first student of the sorted chain.
+ */
+Student_t *sortStudentChainParallel(Student_t *first, int32_t count, StudentCompare_t compare,
+                                    int32_t num_threads, Student_t **last);
+
+/**
+ * @brief Sorts a chain of students by descending average score with a radix sort.
+ *
+ * This function encodes every average score into an unsigned integer whose order is the descending order
+ * of the scores, then sorts the pairs of keys and students with a stable LSD radix sort of four 8-bit digits.
+ * A digit which is the same for every student is skipped, so scores of a narrow range take fewer passes.
+ * The chain is relinked in the sorted order, students having the same average score keep their order.
+ * The chain is merge sorted with compare instead if the memory of the keys cannot be allocated.
+ *
+ * @param first The first student of the chain, the chain ends with a NULL next pointer.
+ * @param count The number of students of the chain.
+ * @param compare The function which compares two students by descending average score.
+ * @param last Pointer to a variable which receives the last student of the sorted chain.
+ * @return The first student of the sorted chain.
+ */
+Student_t *sortStudentChainByScore(Student_t *first, int32_t count, StudentCompare_t compare, Student_t **last);
+
+/**
+ * @brief Sorts the score column and the student column of a list by descending average score.
+ *
+ * This function sorts the rows of the columns like sortStudentChainByScore sorts a chain, but reads
+ * the keys from the contiguous score column instead of the students. Both columns are rewritten
+ * in the sorted order and the students are relinked in that order.
+ * Rows having the same average score keep their order.
+ *
+ * @param scores The average score of each row.
+ * @param students The student of each row.
+ * @param count The number of rows, at least 1.
+ * @param last Pointer to a variable which receives the last student of the sorted chain.
+ * @return The first student of the sorted chain, NULL if the memory of the keys cannot be allocated.
+ */
+Student_t *sortStudentColumnsByScore(float *scores, Student_t **students, int32_t count, Student_t **last);
+
+/**
+ * @brief Fills a sorted view with the order of a chain of students.
+ *
+ * This function copies the students of a sorted chain into the array of the view in one traversal.
+ * The array only grows, so refilling a view of the same chain allocates no memory.
+ *
+ * @param view The view to be filled.
+ * @param first The first student of the chain, the chain ends with a NULL next pointer.
+ * @param count The number of students of the chain.
+ * @return 1 if the view is valid, 0 if the memory of the array cannot be allocated.
+ */
+int32_t fillSortedView(SortedView_t *view, Student_t *first, int32_t count);
+
+/**
+ * @brief Fills a sorted view with an array of students.
+ *
+ * This function copies an array of students which is already in the sorted order into the view,
+ * without following the next pointers of the students.
+ *
+ * @param view The view to be filled.
+ * @param students The students in the sorted order.
+ * @param count The number of students.
+ * @return 1 if the view is valid, 0 if the memory of the array cannot be allocated.
+ */
+int32_t copySortedView(SortedView_t *view, Student_t *const *students, int32_t count);
+
+/**
+ * @brief Relinks the students of a sorted view into a chain.
+ *
+ * This function sets the next pointer of every student of the view to the student after it,
+ * so the chain is in the order of the view. The view must be valid and not empty.
+ *
+ * @param view The view to be linked.
+ * @param last Pointer to a variable which receives the last student of the chain.
+ * @return The first student of the chain.
+ */
+Student_t *linkSortedView(const SortedView_t *view, Student_t **last);
+
+/**
+ * @brief Checks if two students of a sorted view have the same key.
+ *
+ * This function compares every student of a valid view with the student after it and sets is_tie_free
+ * of the view, which stays 0 for an invalid view.
+ *
+ * @param view The view to be checked.
+ * @param compare The function which compares two students in the order of the view.
+ */
+void markSortedViewTies(SortedView_t *view, StudentCompare_t compare);
+
+/**
+ * @brief Frees the array of a sorted view.
+ *
+ * This function frees the array of a view and makes the view empty and invalid.
+ * The students themselves are not freed.
+ *
+ * @param view The view to be freed.
+ */
+void freeSortedView(SortedView_t *view);
+
+#endif /* LIST_SORT_H */
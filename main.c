@@ -19,6 +19,20 @@
 #include <stdint.h>          /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
 #include "manage_students.h" /* Include header file for managing students' information by using linked list */
 #include "input_handler.h"   /* Include input handler header file for handling user input */
+#include "csv_import.h"      /* Include header file for importing students from a CSV file */
+#include "batch_runner.h"    /* Include header file for running the program in batch mode */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Shows the menu of the program.
+ *
+ * This function initializes the variables and provides the user with a menu to interact with the program.
+ *
+ * @return 0 if the program runs successfully.
+ */
+static int32_t runMenu(void);
 
 /*******************************************************************************
  * Code
@@ -26,14 +40,75 @@
 /**
  * @brief The main function of the program.
  *
- * This function is the main function of the program. It initializes the variables and provides
- * the user with a menu to interact with the program.
+ * This function is the main function of the program.
+ * When it is started with "--columnar", the list uses the columnar storage, see setColumnarStorage.
+ * When it is started with "--batch [file]", it runs the commands of the file (or of the standard input)
+ * without showing the menu, see runBatchCommands. Otherwise it shows the menu of the program.
+ *
+ * @param argc The number of arguments of the program.
+ * @param argv The arguments of the program.
+ * @return 0 if the program runs successfully.
+ */
+int main(int argc, char *argv[])
+{
+    int32_t exit_code = 0;       /* Initialize variable to store the exit code of the program */
+    FILE *batch_file = stdin;    /* Initialize variable to store the file of commands in batch mode */
+    int32_t arg = 1;             /* Index of the first argument which is not an option of the storage */
+
+    /* Select the columnar storage of the list if it is asked for */
+    if ((argc > arg) && (strcmp(argv[arg], "--columnar") == 0))
+    {
+        setColumnarStorage(1);
+        arg++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* If the program is started in batch mode */
+    if ((argc > arg) && (strcmp(argv[arg], "--batch") == 0))
+    {
+        /* Open the file of commands if there is one */
+        if (argc > (arg + 1))
+        {
+            batch_file = fopen(argv[arg + 1], "r");
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        /* Run the commands */
+        if (batch_file == NULL)
+        {
+            fprintf(stderr, "Cannot open '%s'\n", argv[arg + 1]);
+            exit_code = 1;
+        }
+        else
+        {
+            exit_code = (runBatchCommands(batch_file) == 0) ? 0 : 1;
+        }
+    }
+    /* Otherwise show the menu of the program */
+    else
+    {
+        exit_code = runMenu();
+    }
+    /* Return the exit code of the program */
+    return exit_code;
+}
+
+/**
+ * @brief Shows the menu of the program.
+ *
+ * This function initializes the variables and provides the user with a menu to interact with the program.
  * The program allows the user to manage a list of students in a class, including initializing the list,
  * adding and deleting students' information, sorting the list, and searching for student information.
  *
  * @return 0 if the program runs successfully.
  */
-int main(void)
+static int32_t runMenu(void)
 {
     int32_t choice = 0;          /* Initialize variable to store user choice */
     int32_t num_students = 0;    /* Initialize variable to store the number of students */
@@ -45,6 +120,10 @@ int main(void)
     int8_t name[100];            /* Declare character array to store student's name */
     int8_t account[30];          /* Declare character array to store student's account */
     float average_score = 0;     /* Initialize variable to store student's average score */
+    float min_score = 0;         /* Initialize variable to store the lowest average score of a range */
+    float max_score = 0;         /* Initialize variable to store the highest average score of a range */
+    CsvImportResult_t import_result;    /* Declare variable to store the result of a CSV import */
+    int32_t num_skipped = 0;            /* Declare variable to store the number of records skipped by a load */
 
     do
     {
@@ -61,7 +140,9 @@ int main(void)
         printf("| 4. Sort the list by either student's average score or student's name               |\n");
         printf("| 5. Search information of student by either their ID or their name or their account |\n");
         printf("| 6. Display list of students                                                        |\n");
-        printf("| 7. Exit program                                                                    |\n");
+        printf("| 7. Save list of students to a snapshot file                                        |\n");
+        printf("| 8. Load list of students from a snapshot file or a CSV file                        |\n");
+        printf("| 9. Exit program                                                                    |\n");
         printf("|____________________________________________________________________________________|\n");
         printf("\n");
 
@@ -102,8 +183,15 @@ int main(void)
                         fflush(stdin);
                         scanf(" %[^\n]s", ID);
 
+                        /* If the ID is too long */
+                        if (strlen(ID) >= STUDENT_KEY_SIZE)
+                        {
+                            /* Set the validity of the input to 0 and display an error message */
+                            is_valid_input = 0;
+                            printf("\nID must not be longer than %d characters. Please re-enter another ID!!!\n\n", STUDENT_KEY_SIZE - 1);
+                        }
                         /* If the ID already exists in the list */
-                        if (is_ID_Exist(ID))
+                        else if (is_ID_Exist(ID))
                         {
                             /* Set the validity of the input to 0 */
                             is_valid_input = 0;
@@ -132,8 +220,15 @@ int main(void)
                         fflush(stdin);
                         scanf(" %[^\n]s", account);
 
+                        /* If the account is too long */
+                        if (strlen(account) >= STUDENT_KEY_SIZE)
+                        {
+                            /* Set the validity of the input to 0 and display an error message */
+                            is_valid_input = 0;
+                            printf("\nAccount must not be longer than %d characters. Please re-enter another account!!!\n\n", STUDENT_KEY_SIZE - 1);
+                        }
                         /* If the account already exists in the list */
-                        if (is_Account_Exist(account))
+                        else if (is_Account_Exist(account))
                         {
                             /* Set the validity of the input to 0 */
                             is_valid_input = 0;
@@ -216,6 +311,12 @@ int main(void)
                     /* If the list does not exist, inform the user */
                     printf("\nYou have not initialized list of students, please initialize it first!!!\n\n");
                 }
+                /* If the list is a read-only snapshot */
+                else if (is_List_ReadOnly())
+                {
+                    /* The list cannot be modified, inform the user */
+                    printf("\nThe list is opened read-only from a snapshot, please load it or initialize a new list first!!!\n\n");
+                }
                 /* If the list of students exists */
                 else
                 {
@@ -231,8 +332,15 @@ int main(void)
                         fflush(stdin);
                         scanf(" %[^\n]s", ID);
 
+                        /* If the ID is too long */
+                        if (strlen(ID) >= STUDENT_KEY_SIZE)
+                        {
+                            /* Set the validity of the input to 0 and display an error message */
+                            is_valid_input = 0;
+                            printf("\nID must not be longer than %d characters. Please re-enter another ID!!!\n\n", STUDENT_KEY_SIZE - 1);
+                        }
                         /* If the ID already exists in the list */
-                        if (is_ID_Exist(ID))
+                        else if (is_ID_Exist(ID))
                         {
                             /* Set the validity of the input to 0 and display an error message */
                             is_valid_input = 0;
@@ -260,8 +368,15 @@ int main(void)
                         fflush(stdin);
                         scanf(" %[^\n]s", account);
 
+                        /* If the account is too long */
+                        if (strlen(account) >= STUDENT_KEY_SIZE)
+                        {
+                            /* Set the validity of the input to 0 and display an error message */
+                            is_valid_input = 0;
+                            printf("\nAccount must not be longer than %d characters. Please re-enter another account!!!\n\n", STUDENT_KEY_SIZE - 1);
+                        }
                         /* If the account already exists in the list */
-                        if (is_Account_Exist(account))
+                        else if (is_Account_Exist(account))
                         {
                             /* Set the validity of the input to 0 and display an error message */
                             is_valid_input = 0;
@@ -343,6 +458,12 @@ int main(void)
                     /* If the list does not exist, inform the user */
                     printf("\nYou have not initialized list of students, please initialize it first!!!\n\n");
                 }
+                /* If the list is a read-only snapshot */
+                else if (is_List_ReadOnly())
+                {
+                    /* The list cannot be modified, inform the user */
+                    printf("\nThe list is opened read-only from a snapshot, please load it or initialize a new list first!!!\n\n");
+                }
                 else
                 {
                     /* Ask the user to enter the ID of the student to be deleted */
@@ -375,6 +496,12 @@ int main(void)
                     /* If the list does not exist, inform the user */
                     printf("\nYou have not initialized list of students, please initialize it first!!!\n\n");
                 }
+                /* If the list is a read-only snapshot */
+                else if (is_List_ReadOnly())
+                {
+                    /* The list cannot be modified, inform the user */
+                    printf("\nThe list is opened read-only from a snapshot, please load it or initialize a new list first!!!\n\n");
+                }
                 else
                 {
                     /* If the list exists, show menu for the user to choose a sort option */
@@ -443,7 +570,11 @@ int main(void)
                     printf("\n");
                     printf("---* Input '1' to search students's information by their's ID      *---\n");
                     printf("---* Input '2' to search students's information by their's name    *---\n");
-                    printf("---* Input '3' to search students's information by their's account *---\n\n");
+                    printf("---* Input '3' to search students's information by their's account *---\n");
+                    printf("---* Input '4' to search students having an average score in range *---\n");
+                    printf("---* Input '5' to show students having the highest average scores  *---\n");
+                    printf("---* Input '6' to search students whose name starts with a prefix  *---\n");
+                    printf("---* Input '7' to search students whose name contains a text       *---\n\n");
 
                     /* Do while loop to check if choice is valid */
                     do
@@ -522,6 +653,84 @@ int main(void)
                                 /* Break switch statement */
                                 break;
                             }
+                            case 4:
+                            {
+                                /* If the user chooses to search by score, prompt them to enter the range */
+                                printf("\nEnter the lowest average score of the range: ");
+                                fflush(stdin);
+                                scanf("%s", buffer);
+                                is_valid_input = isFloatingNumber(buffer);
+                                min_score = (float)atof(buffer);
+                                printf("Enter the highest average score of the range: ");
+                                fflush(stdin);
+                                scanf("%s", buffer);
+                                is_valid_input = is_valid_input && isFloatingNumber(buffer);
+                                max_score = (float)atof(buffer);
+
+                                /* Check if the range is valid */
+                                if (!is_valid_input || (min_score > max_score))
+                                {
+                                    printf("\nThe range of average scores is not valid!!!\n");
+                                }
+                                else
+                                {
+                                    /* Display the information of the students in the range */
+                                    printf("\n--> Information of student(s) having average score from %.2f to %.2f: \n",
+                                           min_score, max_score);
+                                    if (searchInfoByScoreRange(min_score, max_score) == 0)
+                                    {
+                                        printf("\nNo student has an average score in this range!!!\n");
+                                    }
+                                    else
+                                    {
+                                        /* Do nothing */
+                                    }
+                                }
+                                /* Break switch statement */
+                                break;
+                            }
+                            case 5:
+                            {
+                                /* If the user chooses to show the best students, prompt them to enter the number */
+                                printf("\nEnter the number of students to show: ");
+                                fflush(stdin);
+                                scanf("%s", buffer);
+
+                                /* Check if the number is valid */
+                                if (!isWholeNumber(buffer) || (atoi(buffer) <= 0))
+                                {
+                                    printf("\nYour input is not valid!!!\n");
+                                }
+                                else
+                                {
+                                    /* Display the information of the students having the highest average scores */
+                                    printf("\n--> Information of the student(s) having the highest average scores: \n");
+                                    showTopStudentsByScore(atoi(buffer));
+                                }
+                                /* Break switch statement */
+                                break;
+                            }
+                            case 6:
+                            case 7:
+                            {
+                                /* If the user chooses to search by a part of the name, prompt them to enter it */
+                                printf("\nEnter the %s of the name that you want to search: ", (choice == 6) ? "prefix" : "text");
+                                fflush(stdin);
+                                scanf(" %[^\n]s", name);
+                                /* Display the information of the students whose name matches */
+                                printf("\n--> Information of student(s) whose name %s '%s': \n",
+                                       (choice == 6) ? "starts with" : "contains", name);
+                                if (searchInfoByNamePattern(name, (choice == 6) ? NAME_MATCH_PREFIX : NAME_MATCH_SUBSTRING) == 0)
+                                {
+                                    printf("\nNo student's name matches '%s'!!!\n", name);
+                                }
+                                else
+                                {
+                                    /* Do nothing */
+                                }
+                                /* Break switch statement */
+                                break;
+                            }
                             /* If user enter a invalid choice, then ask them re-enter their choice */
                             default:
                             {
@@ -530,7 +739,7 @@ int main(void)
                             }
                         }
                     } /* Continue the loop until the input choice is valid */
-                    while (!(choice == 1 || choice == 2 || choice == 3));
+                    while (!(choice == 1 || choice == 2 || choice == 3 || choice == 4 || choice == 5 || choice == 6 || choice == 7));
                 }
                 /* Clear the console */
                 clearConsole();
@@ -550,6 +759,8 @@ int main(void)
                     /* If the list exists, display the list of students */
                     printf("\nLIST OF STUDENTS IN CLASS: \n");
                     showListStudents();
+                    /* Display the memory usage of the list */
+                    showMemoryUsage();
                 }
                 /* Clear the console */
                 clearConsole();
@@ -557,6 +768,123 @@ int main(void)
                 break;
             }
             case 7:
+            {
+                /* Check if the list of students exists */
+                if(!is_List_Exist())
+                {
+                    /* If the list does not exist, inform the user */
+                    printf("\nYou have not initialized list of students, please initialize it first!!!\n\n");
+                }
+                else
+                {
+                    /* Ask the user to enter the path of the snapshot file */
+                    printf("\nEnter the path of the snapshot file: ");
+                    fflush(stdin);
+                    scanf(" %[^\n]s", buffer);
+
+                    /* Save the list of students to the snapshot file */
+                    if (saveListToFile((char *)buffer))
+                    {
+                        printf("\n--> Saved %d students to '%s' . . .\n", getListSize(), buffer);
+                    }
+                    else
+                    {
+                        printf("\nCannot save the list of students to '%s'!!!\n", buffer);
+                    }
+                }
+                /* Clear the console */
+                clearConsole();
+                /* Break the switch statement */
+                break;
+            }
+            case 8:
+            {
+                /* Ask the user to enter the path of the file */
+                printf("\nEnter the path of the file: ");
+                fflush(stdin);
+                scanf(" %[^\n]s", buffer);
+
+                /* Show menu for the user to choose a load option */
+                printf("\n");
+                printf("---* Input '1' to load the snapshot into memory                          *---\n");
+                printf("---* Input '2' to open the snapshot read-only without copying its records *---\n");
+                printf("---* Input '3' to import the students of the CSV file into the list      *---\n\n");
+
+                /* Do while loop to check if choice is valid */
+                do
+                {
+                    /* Reset choice to 0 */
+                    choice = 0;
+
+                    /* Ask user enter their option */
+                    printf("Enter your option: ");
+                    fflush(stdin);
+                    scanf("%d", &choice);
+
+                    /* Switch statement for user choice */
+                    switch (choice)
+                    {
+                        case 1:
+                        {
+                            /* Load the list of students from the snapshot file */
+                            if (loadListFromFile((char *)buffer, &num_skipped))
+                            {
+                                printf("\n--> Loaded %d students from '%s', skipped %d invalid records . . .\n",
+                                       getListSize(), buffer, num_skipped);
+                            }
+                            else
+                            {
+                                printf("\nCannot load a valid snapshot from '%s', the list is not changed!!!\n", buffer);
+                            }
+                            /* Break switch statement */
+                            break;
+                        }
+                        case 2:
+                        {
+                            /* Open the snapshot file as a read-only list */
+                            if (openListSnapshot((char *)buffer))
+                            {
+                                printf("\n--> Opened %d students read-only from '%s' . . .\n", getListSize(), buffer);
+                            }
+                            else
+                            {
+                                printf("\nCannot open a valid snapshot from '%s', the list is not changed!!!\n", buffer);
+                            }
+                            /* Break switch statement */
+                            break;
+                        }
+                        case 3:
+                        {
+                            /* Import the students of the CSV file into the list */
+                            if (importStudentsFromCsv((char *)buffer, &import_result))
+                            {
+                                printf("\n--> Imported %d students from '%s', rejected %d rows . . .\n",
+                                       import_result.num_imported, buffer, import_result.num_rejected);
+                                printf("--> %.3f seconds, %.0f rows per second\n",
+                                       import_result.seconds, import_result.rows_per_second);
+                            }
+                            else
+                            {
+                                printf("\nCannot import '%s' into the list!!!\n", buffer);
+                            }
+                            /* Break switch statement */
+                            break;
+                        }
+                        /* If user enter a invalid choice, then ask them re-enter their choice */
+                        default:
+                        {
+                            printf("\nYour input is not valid!!!\n\n");
+                            printf("Please enter again . . .\n");
+                        }
+                    }
+                } /* Continue the loop until the input choice is valid */
+                while (!(choice == 1 || choice == 2 || choice == 3));
+                /* Clear the console */
+                clearConsole();
+                /* Break the switch statement */
+                break;
+            }
+            case 9:
             {
                 /* Print a message indicating the program has exited */
                 printf("\n--- EXITED PROGRAM ---\n");
@@ -575,7 +903,7 @@ int main(void)
             }
         }
     } /* Keep the program running until the user chooses to exit program */
-    while (choice != 7);
+    while (choice != 9);
     /* Return 0 to indicate successful program execution */
     return 0;
 } /* EOF */
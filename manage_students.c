@@ -13,11 +13,26 @@
  * Include
  ******************************************************************************/
 #include "manage_students.h"    /* Include header file of this function file */
-
-/*******************************************************************************
- * Variables
- ******************************************************************************/
-Student_t *head = NULL;      /* This variable is used to store the head of the linked list. */
+#include "student_index.h"      /* Include header file for the hash index of students */
+#include "student_pool.h"       /* Include header file for the slab allocator of students */
+#include "string_pool.h"        /* Include header file for the pool of interned strings */
+#include "score_index.h"        /* Include header file for the score index of students */
+#include "name_index.h"         /* Include header file for the name index of students */
+#include "list_sort.h"          /* Include header file for sorting chains of students */
+#include "list_output.h"        /* Include header file for the buffered writer of the list */
+#include "student_columns.h"    /* Include header file for the columnar storage of students */
+#include "score_stats.h"        /* Include header file for the statistics of average scores */
+#include "list_lock.h"          /* Include header file for the reader-writer lock of the list */
+#include "student_scan.h"       /* Include header file for scanning the students of the list */
+#ifdef _WIN32
+#include <windows.h>            /* For CreateFileMapping(), MapViewOfFile() functions */
+#else
+#include <pthread.h>            /* For pthread_mutex_lock() function */
+#include <fcntl.h>              /* For open() function */
+#include <unistd.h>             /* For close() function */
+#include <sys/mman.h>           /* For mmap(), munmap() functions */
+#include <sys/stat.h>           /* For fstat() function */
+#endif
 
 /*******************************************************************************
  * Prototypes
@@ -32,6 +47,199 @@ Student_t *head = NULL;      /* This variable is used to store the head of the l
  */
 static void showStudentInfo(Student_t *student);
 
+/**
+ * @brief Displays the information of a student given field by field.
+ *
+ * @param ID The ID of the student.
+ * @param name The name of the student.
+ * @param account The account of the student.
+ * @param average_score The average score of the student.
+ */
+static void showRecordInfo(const int8_t *ID, const int8_t *name, const int8_t *account, float average_score);
+
+/**
+ * @brief Gets the name of a record of the read-only snapshot.
+ *
+ * @param record The pointer to the record.
+ * @return The name of the record, an empty string if its offset is outside of the buffer of names.
+ */
+static const int8_t *getMappedName(const SnapshotRecord_t *record);
+
+/**
+ * @brief Finds the next record of the read-only snapshot whose field is equal to a key.
+ *
+ * This function scans the mapped records from a start position and stops at the first match.
+ *
+ * @param field The field to be compared.
+ * @param key The key to be found.
+ * @param start The position of the first record to be compared.
+ * @return The position of the matching record, or the number of records if there is no match.
+ */
+static uint32_t findMappedRecord(StudentField_t field, const int8_t *key, uint32_t start);
+
+/**
+ * @brief Displays every record of the read-only snapshot whose field is equal to a key.
+ *
+ * @param field The field to be compared.
+ * @param key The key to be found.
+ */
+static void showMappedMatches(StudentField_t field, const int8_t *key);
+
+/**
+ * @brief Displays the records of the read-only snapshot having the highest average scores.
+ *
+ * This function scans the mapped records once and keeps the positions of the best k records in an array
+ * ordered like the score index.
+ *
+ * @param k The number of records to be displayed.
+ * @return The number of records displayed.
+ */
+static int32_t showMappedTopScores(int32_t k);
+
+/**
+ * @brief Gets the ID of a student, used as the key of the ID index.
+ *
+ * @param student The pointer to the student.
+ * @return The ID of the student.
+ */
+static const int8_t *getStudentID(const Student_t *student);
+
+/**
+ * @brief Gets the account of a student, used as the key of the account index.
+ *
+ * @param student The pointer to the student.
+ * @return The account of the student.
+ */
+static const int8_t *getStudentAccount(const Student_t *student);
+
+/**
+ * @brief Gets the hash value of the ID of a student, used by the ID index.
+ *
+ * @param student The pointer to the student.
+ * @return The hash value of the ID of the student.
+ */
+static uint32_t getStudentIDHash(const Student_t *student);
+
+/**
+ * @brief Gets the hash value of the account of a student, used by the account index.
+ *
+ * @param student The pointer to the student.
+ * @return The hash value of the account of the student.
+ */
+static uint32_t getStudentAccountHash(const Student_t *student);
+
+/**
+ * @brief Checks if a student has the name of a probe, used by findStudentsByName.
+ *
+ * @param student The student to be checked.
+ * @param probe The student whose name offset is searched.
+ * @return 1 if the student has the name, 0 otherwise.
+ */
+static int32_t matchStudentName(const Student_t *student, const Student_t *probe);
+
+/**
+ * @brief Scans the list for the students matching a probe.
+ *
+ * @param match The function which checks each student.
+ * @param probe The student which the students are matched with.
+ * @param result Pointer to a result set which receives the students found.
+ * @return The number of students found, -1 if the memory of the result set cannot be allocated.
+ */
+static int32_t findStudents(StudentMatch_t match, const Student_t *probe, StudentResultSet_t *result);
+
+/**
+ * @brief Fills the position view from the list if it is not valid.
+ *
+ * @return 1 if the position view is valid, 0 if the memory of its array cannot be allocated.
+ */
+static int32_t fillPositionView(void);
+
+/**
+ * @brief Compares two students by their average score in descending order.
+ *
+ * @param first The first student.
+ * @param second The second student.
+ * @return A negative value if first has a higher average score, a positive value if it has a lower one, 0 otherwise.
+ */
+static int32_t compareByScore(const Student_t *first, const Student_t *second);
+
+/**
+ * @brief Compares two students by their name in ascending order.
+ *
+ * @param first The first student.
+ * @param second The second student.
+ * @return The result of strcmp on the names of the two students.
+ */
+static int32_t compareByName(const Student_t *first, const Student_t *second);
+
+/**
+ * @brief Links a student to the end of the list.
+ *
+ * @param student The student to be linked.
+ */
+static void linkStudentToList(Student_t *student);
+
+/**
+ * @brief Removes a student from every index of the list.
+ *
+ * @param student The student to be removed.
+ */
+static void removeStudentFromIndexes(Student_t *student);
+
+/**
+ * @brief Sorts the list in the order of a sorted view.
+ *
+ * @param view The view of the order, score_view or name_view.
+ * @param compare The function which compares two students in the order of the view.
+ */
+static void sortByView(SortedView_t *view, StudentCompare_t compare);
+
+/**
+ * @brief Resets the list of students without displaying any message.
+ *
+ * This function resets the head, the tail and the number of students of the list, empties the indexes,
+ * the sorted views and the columns and releases every node and every name.
+ */
+static void resetList(void);
+
+/**
+ * @brief Computes the checksum of a buffer.
+ *
+ * This function mixes every byte of a buffer into a 32-bit FNV-1a hash value.
+ *
+ * @param data The buffer.
+ * @param size The number of bytes of the buffer.
+ * @param hash The hash value to start from.
+ * @return The hash value after mixing the buffer.
+ */
+static uint32_t computeChecksum(const uint8_t *data, size_t size, uint32_t hash);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+StudentList_t student_list = {NULL, NULL, 0};   /* This variable is used to store the descriptor of the linked list. */
+static StudentIndex_t id_index = {NULL, 0, 0, 0, getStudentID, getStudentIDHash};                  /* Hash index of the students by ID */
+static StudentIndex_t account_index = {NULL, 0, 0, 0, getStudentAccount, getStudentAccountHash};    /* Hash index of the students by account */
+static ScoreIndex_t score_index = {NULL, 0, 0, 0, 0};                       /* Skip list of the students by average score */
+static const SnapshotHeader_t *mapped_header = NULL;    /* The header of the read-only snapshot, NULL if no snapshot is opened */
+static const SnapshotRecord_t *mapped_records = NULL;   /* The records of the read-only snapshot */
+static const int8_t *mapped_names = NULL;               /* The buffer of names of the read-only snapshot */
+static size_t mapped_size = 0;                          /* The number of bytes of the read-only snapshot */
+static int32_t sort_threads = 1;                        /* The number of threads used to sort the list */
+static int32_t search_threads = 1;                      /* The number of threads used to scan the list */
+static SortedView_t score_view = {NULL, 0, 0, 0, 0};    /* The students in descending order of average score */
+static SortedView_t name_view = {NULL, 0, 0, 0, 0};     /* The students in ascending order of name */
+static const SortedView_t *list_order = NULL;           /* The view whose order the list is in, NULL if none */
+static SortedView_t position_view = {NULL, 0, 0, 0, 0}; /* The students in the order of the list, for the parallel scans */
+static StudentColumns_t student_columns = {NULL, NULL, 0, 0, 0};    /* The score column of the list, if it is enabled */
+#ifdef _WIN32
+static HANDLE mapped_file = INVALID_HANDLE_VALUE;       /* The file handle of the read-only snapshot */
+static HANDLE mapped_mapping = NULL;                    /* The mapping handle of the read-only snapshot */
+static SRWLOCK position_lock = SRWLOCK_INIT;            /* The lock of the readers filling the position view */
+#else
+static pthread_mutex_t position_lock = PTHREAD_MUTEX_INITIALIZER;  /* The lock of the readers filling the position view */
+#endif
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -47,24 +255,56 @@ int32_t is_List_Exist(void)
 {
     int32_t is_exist = 0;           /* Initialize is_exist to 0 */
 
-    /* If head is NULL, set is_exist to 0 */
-    if (head == NULL)
+    lockListShared();
+
+    /* If the list has no student, set is_exist to 0 */
+    if (getListSize() == 0)
     {
         is_exist = 0;
     }
-    /* If head is not NULL, set is_exist to 1 */
+    /* If the list has at least one student, set is_exist to 1 */
     else
     {
         is_exist = 1;
     }
+    unlockListShared();
     /* Return the value of is_exist */
     return is_exist;
 }
 
+/**
+ * @brief Gets the number of students in the list.
+ *
+ * This function returns the number of students which is kept in the list descriptor,
+ * or the number of records of the read-only snapshot.
+ *
+ * @return The number of students in the list.
+ */
+int32_t getListSize(void)
+{
+    int32_t count = 0;                      /* The number of students */
+
+    lockListShared();
+    count = student_list.count;
+
+    /* If a read-only snapshot is opened, use its number of records */
+    if (mapped_header != NULL)
+    {
+        count = (int32_t)mapped_header->count;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListShared();
+    /* Return the number of students */
+    return count;
+}
+
 /**
  * @brief Checks if the input ID exists.
  *
- * This function checks if the input ID exists.
+ * This function checks if the input ID exists by looking it up in the ID index.
  * It returns 1 if the ID exists, 0 otherwise.
  *
  * @param ID The ID to be checked.
@@ -73,24 +313,24 @@ int32_t is_List_Exist(void)
 int32_t is_ID_Exist(int8_t *ID)
 {
     int32_t is_exist = 0;       /* Initialize is_exist to 0 */
-    Student_t *temp = head;     /* Temporary pointer to traverse the list */
 
-    /* Traverse the linked list */
-    while (temp != NULL)
+    lockListShared();
+
+    /* If a read-only snapshot is opened, scan its records */
+    if (mapped_header != NULL)
     {
-        /* If the ID of temp is equal to the input ID */
-        if (strcmp(temp->ID, ID) == 0)
-        {
-            /* Set is_exist to 1 */
-            is_exist = 1;
-        }
-        else
-        {
-            /* Do nothing */
-        }
-        /* Move to the next node of linked list */
-        temp = temp->next;
+        is_exist = (findMappedRecord(STUDENT_FIELD_ID, ID, 0) < mapped_header->count) ? 1 : 0;
+    }
+    /* If the ID index holds a student with the input ID, set is_exist to 1 */
+    else if (findStudentInIndex(&id_index, ID) != NULL)
+    {
+        is_exist = 1;
     }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListShared();
     /* Return the value of is_exist */
     return is_exist;
 }
@@ -98,7 +338,8 @@ int32_t is_ID_Exist(int8_t *ID)
 /**
  * @brief Checks if the input name exists.
  *
- * This function checks if the input name exists.
+ * This function checks if the input name exists by looking it up in the name index.
+ * A name which has never been interned into the string pool does not exist.
  * It returns 1 if the name exists, 0 otherwise.
  *
  * @param name The name to be checked.
@@ -106,25 +347,23 @@ int32_t is_ID_Exist(int8_t *ID)
  */
 int32_t is_Name_Exist(int8_t *name)
 {
-    int32_t is_exist = 0;       /* Initialize is_exist to 0 */
-    Student_t *temp = head;     /* Temporary pointer to traverse the list */
+    int32_t is_exist = 0;                   /* Initialize is_exist to 0 */
+    const NameEntry_t *entry = NULL;        /* The entry of the input name in the name index */
 
-    /* Traverse the linked list */
-    while (temp != NULL)
+    lockListShared();
+
+    /* If a read-only snapshot is opened, scan its records */
+    if (mapped_header != NULL)
     {
-        /* If the name of temp is equal to the input name */
-        if (strcmp(temp->name, name) == 0)
-        {
-            /* Set is_exist to 1 */
-            is_exist = 1;
-        }
-        else
-        {
-            /* Do nothing */
-        }
-        /* Move to the next node of linked list */
-        temp = temp->next;
+        is_exist = (findMappedRecord(STUDENT_FIELD_NAME, name, 0) < mapped_header->count) ? 1 : 0;
+    }
+    else
+    {
+        /* If at least one student of the list has the input name, set is_exist to 1 */
+        entry = findNameEntry(findPooledString(name));
+        is_exist = ((entry != NULL) && (entry->count > 0)) ? 1 : 0;
     }
+    unlockListShared();
     /* Return the value of is_exist */
     return is_exist;
 }
@@ -132,7 +371,7 @@ int32_t is_Name_Exist(int8_t *name)
 /**
  * @brief Checks if the input account exists.
  *
- * This function checks if the input account exists.
+ * This function checks if the input account exists by looking it up in the account index.
  * It returns 1 if the account exists, 0 otherwise.
  *
  * @param account The account to be checked.
@@ -141,32 +380,117 @@ int32_t is_Name_Exist(int8_t *name)
 int32_t is_Account_Exist(int8_t *account)
 {
     int32_t is_exist = 0;       /* Initialize is_exist to 0 */
-    Student_t *temp = head;     /* Temporary pointer to traverse the list */
 
-    /* Traverse the linked list */
-    while (temp != NULL)
+    lockListShared();
+
+    /* If a read-only snapshot is opened, scan its records */
+    if (mapped_header != NULL)
+    {
+        is_exist = (findMappedRecord(STUDENT_FIELD_ACCOUNT, account, 0) < mapped_header->count) ? 1 : 0;
+    }
+    /* If the account index holds a student with the input account, set is_exist to 1 */
+    else if (findStudentInIndex(&account_index, account) != NULL)
+    {
+        is_exist = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListShared();
+    /* Return the value of is_exist */
+    return is_exist;
+}
+
+/**
+ * @brief Checks if the ID and the account of a new student are already on the list.
+ *
+ * This function checks both fields with one call: the ID index and the account index are looked up,
+ * or the records of a read-only snapshot are scanned once, stopping as soon as every checked field
+ * has been found.
+ * A field is not checked if its pointer is NULL.
+ *
+ * @param ID The ID to be checked, or NULL.
+ * @param account The account to be checked, or NULL.
+ * @return STUDENT_CONFLICT_NONE, or STUDENT_CONFLICT_ID and/or STUDENT_CONFLICT_ACCOUNT combined with '|'.
+ */
+uint32_t checkStudentConflicts(const int8_t *ID, const int8_t *account)
+{
+    uint32_t conflicts = STUDENT_CONFLICT_NONE;     /* Initialize conflicts to STUDENT_CONFLICT_NONE */
+    uint32_t checked = ((ID != NULL) ? STUDENT_CONFLICT_ID : 0u) |
+                       ((account != NULL) ? STUDENT_CONFLICT_ACCOUNT : 0u);    /* The fields to be checked */
+    uint32_t i = 0;                                 /* Position of each record of the read-only snapshot */
+
+    lockListShared();
+
+    /* If a read-only snapshot is opened, scan its records until every checked field is found */
+    if (mapped_header != NULL)
+    {
+        for (i = 0; (i < mapped_header->count) && (conflicts != checked); i++)
+        {
+            if ((ID != NULL) && (strncmp(mapped_records[i].ID, ID, STUDENT_KEY_SIZE) == 0))
+            {
+                conflicts |= STUDENT_CONFLICT_ID;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            if ((account != NULL) && (strncmp(mapped_records[i].account, account, STUDENT_KEY_SIZE) == 0))
+            {
+                conflicts |= STUDENT_CONFLICT_ACCOUNT;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    else
     {
-        /* If the account of temp is equal to the input account */
-        if (strcmp(temp->account, account) == 0)
+        /* Look every checked field up in its index */
+        if ((ID != NULL) && (findStudentInIndex(&id_index, ID) != NULL))
+        {
+            conflicts |= STUDENT_CONFLICT_ID;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if ((account != NULL) && (findStudentInIndex(&account_index, account) != NULL))
         {
-            /* Set is_exist to 1 */
-            is_exist = 1;
+            conflicts |= STUDENT_CONFLICT_ACCOUNT;
         }
         else
         {
             /* Do nothing */
         }
-        /* Move to the next node of linked list */
-        temp = temp->next;
     }
-    /* Return the value of is_exist */
-    return is_exist;
+    unlockListShared();
+    /* Return the conflicting fields */
+    return conflicts;
+}
+
+/**
+ * @brief Gets the name of a student.
+ *
+ * This function returns the name of a student from the string pool.
+ * The returned pointer is only valid until the next student is created.
+ *
+ * @param student The pointer to the student.
+ * @return The name of the student.
+ */
+const int8_t *getStudentName(const Student_t *student)
+{
+    return getPooledString(student->name_offset);
 }
 
 /**
  * @brief Creates a new student information (create new node of linked list).
  *
  * This function creates a new student information.
+ * The node is taken from the slab allocator of students and the name is interned into the string pool.
+ * The ID and the account are truncated to STUDENT_KEY_SIZE - 1 characters.
  * It returns a pointer to the new student (new node).
  *
  * @param ID The ID of the student.
@@ -177,20 +501,30 @@ int32_t is_Account_Exist(int8_t *account)
  */
 Student_t *createStudentInfo(int8_t *ID, int8_t *name, int8_t *account, float average_score)
 {
-    Student_t *new_student = (Student_t *)malloc(sizeof(Student_t));  /* Allocate memory for the new_student */
+    Student_t *new_student = NULL;      /* The new_student */
+
+    lockListExclusive();
+    /* Allocate a node for the new_student */
+    new_student = allocStudentNode();
 
     /* Copy the ID to the new_student */
-    strcpy(new_student->ID, ID);
-    /* Copy the name to the new_student */
-    strcpy(new_student->name, name);
+    strncpy(new_student->ID, ID, STUDENT_KEY_SIZE - 1);
+    new_student->ID[STUDENT_KEY_SIZE - 1] = '\0';
+    /* Intern the name into the string pool */
+    new_student->name_offset = internString(name);
     /* Copy the account to the new_student */
-    strcpy(new_student->account, account);
+    strncpy(new_student->account, account, STUDENT_KEY_SIZE - 1);
+    new_student->account[STUDENT_KEY_SIZE - 1] = '\0';
+    /* Hash the ID and the account once, the indexes and the scans compare the hash values first */
+    new_student->id_hash = hashStudentKey(new_student->ID);
+    new_student->account_hash = hashStudentKey(new_student->account);
     /* Set the average score of the new_student */
     new_student->average_score = average_score;
 
     /* Set the next pointer of the new_student to NULL */
     new_student->next = NULL;
 
+    unlockListExclusive();
     /* Return a pointer to the new_student */
     return new_student;
 }
@@ -200,12 +534,14 @@ Student_t *createStudentInfo(int8_t *ID, int8_t *name, int8_t *account, float av
  *
  * This function checks if the head of the list is not NULL.
  * If it is not NULL, it prints a message to the console.
- * It then sets the head of the list to NULL.
+ * It then resets the head, the tail and the number of students of the list and
+ * releases every node of the list at once.
  */
 void clearList(void)
 {
+    lockListExclusive();
     /* If the head of the list is not NULL */
-    if (head != NULL)
+    if (student_list.head != NULL)
     {
         printf("\nDeleting previous list of students . . .\n\n");
         printf("You can re-create a new studnet list now . . .\n");
@@ -215,8 +551,10 @@ void clearList(void)
     {
         printf("\nProceed to create a new student list . . .\n");
     }
-    /* Set the head of the list to NULL */
-    head = NULL;
+    /* Close the read-only snapshot and reset the list */
+    closeListSnapshot();
+    resetList();
+    unlockListExclusive();
 }
 
 /**
@@ -224,295 +562,2231 @@ void clearList(void)
  *
  * This function adds a new student to the list.
  * If the head of the list is NULL, it sets the head to the new student.
- * If the head of the list is not NULL, it traverses the list to find the last student and sets
- * the next pointer of the last student to the new student.
+ * If the head of the list is not NULL, it sets the next pointer of the tail of the list to the
+ * new student. The tail of the list is then moved to the new student.
+ * The student is also inserted into the ID index, the account index, the name index and the score index.
+ * A read-only snapshot cannot be modified, so the student is not added and its node is freed.
  *
  * @param student The new student to be added to the list.
  */
 void addStudentInfoToList(Student_t *student)
 {
-    /* If the head of the linked list is NULL */
-    if (head == NULL)
+    lockListExclusive();
+    /* If the list is not a read-only snapshot */
+    if (mapped_header == NULL)
     {
-        /* Set the head to the new student */
-        head = student;
+        /* Link the student to the list and keep the score index in sync with the list */
+        linkStudentToList(student);
+        insertStudentToScoreIndex(&score_index, student);
     }
-    /* If the head of the list is not NULL */
     else
     {
-        Student_t *temp = head;             /* Temporary pointer to traverse the list */
-
-        /* Traverse the list to find the last student */
-        while (temp->next != NULL)
-        {
-            /* Move to the next student */
-            temp = temp->next;
-        }
-        /* Set the next pointer of the last student to the new student */
-        temp->next = student;
+        freeStudentNode(student);
     }
+    unlockListExclusive();
 }
 
 /**
- * @brief Deletes a student from the list.
+ * @brief Links a student to the end of the list.
  *
- * This function deletes a student from the list.
- * It takes the ID of the student to be deleted as an argument.
- * If the node to be deleted is the first node, it sets the head to the next node and
- * frees the memory of the first node.
- * If the node to be deleted is not the first node, it traverses the list to find the node
- * to delete and the pointer before it.
- * It then sets the next pointer of the node before the node to be deleted to the next node of the node
- * to be deleted and frees the memory of the node to be deleted.
+ * This function links a student after the tail of the list, inserts it into the ID index,
+ * the account index and the name index, but not into the score index, and appends it to the columns.
  *
- * @param ID The ID of the student to be deleted.
+ * @param student The student to be linked.
  */
-void deleteStudentInfo(int8_t *ID)
+static void linkStudentToList(Student_t *student)
 {
-    Student_t *temp = head;          /* Temporary pointer to traverse the list */
-    Student_t *pre_temp = NULL;      /* Pointer before temp to adjust node connection of linked list */
-
-    /* In case the node to be deleted is the first node */
-    if (temp != NULL && (strcmp(temp->ID, ID) == 0))
+    /* If the head of the linked list is NULL */
+    if (student_list.head == NULL)
     {
-        /* Set the head to the next node */
-        head = temp->next;
-        /* Free the memory of the first node */
-        free(temp);
+        /* Set the head to the new student */
+        student_list.head = student;
     }
+    /* If the head of the list is not NULL */
     else
     {
-        /* Traverse the list to find the node to delete and the pointer before it */
-        while ((temp != NULL) && (strcmp(temp->ID, ID) != 0))
-        {
-            /* Set pre_temp to temp */
-            pre_temp = temp;
-            /* Move to the next node */
-            temp = temp->next;
-        }
-        /* Set the next pointer of the node before the node which to be deleted
-           to the next node of the node which to be deleted */
-        pre_temp->next = temp->next;
-        /* Free the memory of the node which to be deleted */
-        free(temp);
+        /* Set the next pointer of the last student to the new student */
+        student_list.tail->next = student;
     }
+    /* Move the tail to the new student and increase the number of students */
+    student_list.tail = student;
+    student_list.count++;
+    /* The sorted views miss the new student and the list is no longer sorted */
+    score_view.is_valid = 0;
+    name_view.is_valid = 0;
+    position_view.is_valid = 0;
+    list_order = NULL;
+    /* Keep the indexes in sync with the list */
+    insertStudentToIndex(&id_index, student);
+    insertStudentToIndex(&account_index, student);
+    addStudentToNameIndex(student);
+    appendStudentToColumns(&student_columns, student);
 }
 
 /**
- * @brief Sorts the linked list by student's average score.
+ * @brief Adds several new students to the list at once.
+ *
+ * This function adds the students of a batch of records, the list must not be a read-only snapshot.
+ * The nodes of the batch are allocated in one contiguous block, or one by one if the memory of the block
+ * cannot be allocated, and the ID index and the account index are presized for the final number of students.
+ * Each record is checked once against the indexes, which already hold the students of the list and the accepted
+ * records of the batch, so duplicates inside the batch are found by the same lookup. A record is rejected if its ID
+ * or its account is empty, not shorter than STUDENT_KEY_SIZE characters or already used.
+ * The accepted students are chained in the order of the records and spliced after the tail of the list.
+ * The score index is rebuilt at once when the batch is at least as large as the list, otherwise the students
+ * are inserted into it one by one.
  *
- * This function sorts the linked list by student's average score in descending order.
- * It uses the bubble sort algorithm to compare the average scores of each student.
- * If the average score of the current student is less than the average score of the next student,
- * it swaps the average scores of the two students.
+ * @param records The records of the students to be added.
+ * @param num_records The number of records.
+ * @param num_rejected Pointer to a variable which receives the number of rejected records.
+ * @return The number of students added.
  */
-void sortByScore(void)
+int32_t addStudentsBatch(const StudentRecord_t *records, int32_t num_records, int32_t *num_rejected)
 {
-    Student_t* current = head;       /* Initialize current variable to head of linked list */
-    Student_t* next_current = NULL;  /* Initialize variable next_current to NULL */
-    float temp = 0;                  /* Temporary variable to store student's average score used for swapping data */
+    Student_t *block = NULL;            /* The contiguous block of nodes of the batch, NULL if it cannot be allocated */
+    Student_t *first = NULL;            /* The first accepted student of the batch */
+    Student_t *last = NULL;             /* The last accepted student of the batch */
+    Student_t *student = NULL;          /* The node of each accepted record */
+    const StudentRecord_t *record = NULL;   /* Each record of the batch */
+    int32_t num_added = 0;              /* The number of students added */
+    int32_t is_rebuilt = 0;             /* 1 if the score index is rebuilt after the batch */
+    int32_t i = 0;                      /* Position of each record */
+    size_t ID_length = 0;               /* The number of characters of the ID of the record */
+    size_t account_length = 0;          /* The number of characters of the account of the record */
+
+    lockListExclusive();
 
-    /* Traverse the linked list */
-    while (current != NULL)
+    /* If the batch is not empty and the list is not a read-only snapshot */
+    if ((num_records > 0) && (mapped_header == NULL))
     {
-        /* Set next_current to the next student */
-        next_current = current->next;
+        block = allocStudentNodes(num_records);
+        reserveStudentIndex(&id_index, (uint32_t)student_list.count + (uint32_t)num_records);
+        reserveStudentIndex(&account_index, (uint32_t)student_list.count + (uint32_t)num_records);
+        reserveStudentColumns(&student_columns, (uint32_t)student_list.count + (uint32_t)num_records);
+        is_rebuilt = (num_records >= student_list.count) ? 1 : 0;
 
-        /* While next_current is not NULL */
-        while (next_current != NULL)
+        /* Check and chain every record in one pass */
+        for (i = 0; i < num_records; i++)
         {
-            /* If the average score of current is less than the average score of next_current */
-            if (current->average_score < next_current->average_score)
+            record = &records[i];
+            ID_length = strlen(record->ID);
+            account_length = strlen(record->account);
+            if ((ID_length > 0) && (ID_length < STUDENT_KEY_SIZE) &&
+                (account_length > 0) && (account_length < STUDENT_KEY_SIZE) &&
+                (checkStudentConflicts(record->ID, record->account) == STUDENT_CONFLICT_NONE))
             {
-                /* Set temp to the average score of current student */
-                temp = current->average_score;
-                /* Set the average score of current student to the average score of next student */
-                current->average_score = next_current->average_score;
-                /* Set the average score of next student to temp */
-                next_current->average_score = temp;
+                /* Fill the next node of the block, or a node of its own without a block */
+                student = (block != NULL) ? &block[num_added] : allocStudentNode();
+                memcpy(student->ID, record->ID, ID_length + 1);
+                memcpy(student->account, record->account, account_length + 1);
+                student->id_hash = hashStudentKey(student->ID);
+                student->account_hash = hashStudentKey(student->account);
+                student->name_offset = internString(record->name);
+                student->average_score = record->average_score;
+                student->next = NULL;
+                /* Insert the student into the indexes, so the following records see it */
+                insertStudentToIndex(&id_index, student);
+                insertStudentToIndex(&account_index, student);
+                addStudentToNameIndex(student);
+                appendStudentToColumns(&student_columns, student);
+                if (is_rebuilt == 0)
+                {
+                    insertStudentToScoreIndex(&score_index, student);
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                /* Chain the student after the previous accepted student */
+                if (last == NULL)
+                {
+                    first = student;
+                }
+                else
+                {
+                    last->next = student;
+                }
+                last = student;
+                num_added++;
             }
             else
             {
                 /* Do nothing */
             }
-            /* Move to the next student */
-            next_current = next_current->next;
         }
-        /* Move to the next student */
-        current = current->next;
-    }
-}
-
-/**
- * @brief Sorts the linked list by student's name.
- *
- * This function sorts the list of students by their name in ascending order.
- * It uses the bubble sort algorithm to compare the names of each student.
- * If the name of the current student is greater than the name of the next student,
- * it swaps the names of the two students.
- */
-void sortByName(void)
-{
-    Student_t* current = head;          /* Initialize current variable to head of linked list */
-    Student_t* next_current = NULL;     /* Initialize next_current variable to NULL */
-    int8_t temp[100];                   /* Temporary variable to store student's name used for swapping data */
 
-    /* Traverse the linked list */
-    while (current != NULL)
-    {
-        /* Set next_current to the next student */
-        next_current = current->next;
+        /* Give the nodes of the rejected records back to the slab allocator */
+        for (i = num_added; (block != NULL) && (i < num_records); i++)
+        {
+            freeStudentNode(&block[i]);
+        }
 
-        /* While next_current is not NULL */
-        while (next_current != NULL)
+        /* Splice the chain of the batch after the tail of the list */
+        if (first != NULL)
         {
-            /* If the name of current is more than the name of next_current */
-            if (strcmp(current->name, next_current->name) > 0)
+            if (student_list.head == NULL)
             {
-                /* Copy the name of next student to temp */
-                strcpy(temp, next_current->name);
-                /* Copy the name of current student to the name of next student */
-                strcpy(next_current->name, current->name);
-                /* Copy the data of temp to the name of current student */
-                strcpy(current->name, temp);
+                student_list.head = first;
             }
             else
             {
-                /* Do nothing */
+                student_list.tail->next = first;
             }
-            /* Move to the next student */
-            next_current = next_current->next;
+            student_list.tail = last;
+            student_list.count += num_added;
+            /* The sorted views miss the new students and the list is no longer sorted */
+            score_view.is_valid = 0;
+            name_view.is_valid = 0;
+            position_view.is_valid = 0;
+            list_order = NULL;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        /* Build the score index at once for a large batch */
+        if (is_rebuilt && (num_added > 0))
+        {
+            buildScoreIndex(&score_index, student_list.head);
+        }
+        else
+        {
+            /* Do nothing */
         }
-        /* Move to the next student */
-        current = current->next;
     }
+    else
+    {
+        /* Do nothing */
+    }
+    *num_rejected = ((num_records > 0) ? num_records : 0) - num_added;
+    unlockListExclusive();
+    /* Return the number of students added */
+    return num_added;
 }
 
 /**
- * @brief Searching for an student's information by their ID.
+ * @brief Deletes a student from the list.
  *
- * This function searches for a student's information by their ID.
- * If the ID of the current student is equal to the input ID,
- * it displays the information of the student.
+ * This function deletes a student from the list.
+ * It takes the ID of the student to be deleted as an argument.
+ * The node to be deleted is looked up in the ID index, nothing happens if the ID is not on the list.
+ * If the node to be deleted is the first node, it sets the head to the next node and
+ * frees the memory of the first node.
+ * If the node to be deleted is not the first node, it traverses the list to find the pointer before it
+ * by comparing node addresses only.
+ * It then sets the next pointer of the node before the node to be deleted to the next node of the node
+ * to be deleted and gives the node to be deleted back to the slab allocator.
+ * The tail, the number of students, the indexes and the columns of the list are updated accordingly.
  *
- * @param ID The ID of the student to be searched.
+ * @param ID The ID of the student to be deleted.
  */
-void searchInfoByID(int8_t *ID)
+void deleteStudentInfo(int8_t *ID)
 {
-    Student_t* temp = head;        /* Temporary pointer to traverse the list */
+    Student_t *target = NULL;                               /* The node to be deleted */
+    Student_t *pre_temp = NULL;                             /* Pointer before target to adjust node connection of linked list */
+    uint32_t row = 0;                                       /* The position of target in the list */
 
-    /* Traverse the linked list */
-    while (temp != NULL)
+    lockListExclusive();
+    target = findStudentInIndex(&id_index, ID);
+
+    /* If the ID is on the list and the list is not a read-only snapshot */
+    if ((target != NULL) && (mapped_header == NULL))
     {
-        /* If the ID of temp is equal to the input ID */
-        if (strcmp(temp->ID, ID) == 0)
+        /* Remove the node from the indexes */
+        removeStudentFromIndexes(target);
+
+        /* In case the node to be deleted is the first node */
+        if (target == student_list.head)
         {
-            /* Display the information of the student */
-            showStudentInfo(temp);
+            /* Set the head to the next node */
+            student_list.head = target->next;
         }
         else
         {
-            /* Do nothing */
+            pre_temp = student_list.head;
+            row = 1;
+            /* Traverse the list to find the pointer before the node to delete */
+            while (pre_temp->next != target)
+            {
+                /* Move to the next node */
+                pre_temp = pre_temp->next;
+                row++;
+            }
+            /* Set the next pointer of the node before the node which to be deleted
+               to the next node of the node which to be deleted */
+            pre_temp->next = target->next;
         }
-        /* Move to the next student */
-        temp = temp->next;
-    }
+        /* If the node which to be deleted is the last node, move the tail to the node before it */
+        if (student_list.tail == target)
+        {
+            student_list.tail = pre_temp;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        /* Remove the row of the node from the columns */
+        removeStudentColumnRows(&student_columns, &row, 1);
+        /* Give the node which to be deleted back to the slab allocator */
+        freeStudentNode(target);
+        /* Decrease the number of students */
+        student_list.count--;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListExclusive();
+}
+
+/**
+ * @brief Deletes several students from the list at once.
+ *
+ * This function deletes the students having the given IDs, nothing happens if the list is a read-only snapshot.
+ * The students to be deleted are looked up in the ID index and put into a temporary hash set, then the list
+ * is traversed once: every student of the set is unlinked, removed from the indexes and given back to
+ * the slab allocator. The traversal stops after the last student of the set, then the rows of the deleted
+ * students are removed from the columns in one pass.
+ * An ID given several times is only deleted once.
+ *
+ * @param IDs The IDs of the students to be deleted.
+ * @param num_IDs The number of IDs.
+ * @param missing_IDs An array of at least num_IDs pointers which receives the IDs which are not on the list, or NULL.
+ * @param num_missing Pointer to a variable which receives the number of IDs which are not on the list.
+ * @return The number of students deleted.
+ */
+int32_t deleteStudentsBatch(int8_t **IDs, int32_t num_IDs, int8_t **missing_IDs, int32_t *num_missing)
+{
+    StudentIndex_t targets;             /* The hash set of the students to be deleted */
+    Student_t *target = NULL;           /* The student having each ID */
+    Student_t *pre_temp = NULL;         /* Pointer before temp to adjust node connection of linked list */
+    Student_t *temp = NULL;             /* Temporary pointer to traverse the list */
+    Student_t *next = NULL;             /* The student after temp */
+    uint32_t *rows = NULL;              /* The positions of the deleted students in the list */
+    uint32_t row = 0;                   /* The position of temp in the list */
+    int32_t num_deleted = 0;            /* The number of students deleted */
+    int32_t i = 0;                      /* Position of each ID */
+
+    lockListExclusive();
+
+    *num_missing = 0;
+    initStudentIndex(&targets, getStudentID, getStudentIDHash);
+
+    /* If the list is not a read-only snapshot, put the students having the IDs into the hash set */
+    if (mapped_header == NULL)
+    {
+        reserveStudentIndex(&targets, (num_IDs > 0) ? (uint32_t)num_IDs : 0);
+        for (i = 0; i < num_IDs; i++)
+        {
+            target = findStudentInIndex(&id_index, IDs[i]);
+            if (target == NULL)
+            {
+                /* Report the ID which is not on the list */
+                if (missing_IDs != NULL)
+                {
+                    missing_IDs[*num_missing] = IDs[i];
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                (*num_missing)++;
+            }
+            else if (findStudentInIndex(&targets, IDs[i]) == NULL)
+            {
+                insertStudentToIndex(&targets, target);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Keep the positions of the deleted students for the columns, without memory the columns are dropped */
+    if (student_columns.is_enabled && (targets.count > 0))
+    {
+        rows = (uint32_t *)malloc(targets.count * sizeof(uint32_t));
+        if (rows == NULL)
+        {
+            enableStudentColumns(&student_columns, 0, NULL, 0);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Traverse the list once until every student of the hash set is deleted */
+    temp = (targets.count > 0) ? student_list.head : NULL;
+    while ((temp != NULL) && ((uint32_t)num_deleted < targets.count))
+    {
+        next = temp->next;
+        /* If the student is in the hash set, unlink it */
+        if (findStudentInIndex(&targets, temp->ID) == temp)
+        {
+            removeStudentFromIndexes(temp);
+            if (pre_temp == NULL)
+            {
+                student_list.head = next;
+            }
+            else
+            {
+                pre_temp->next = next;
+            }
+            if (student_list.tail == temp)
+            {
+                student_list.tail = pre_temp;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            freeStudentNode(temp);
+            student_list.count--;
+            if (rows != NULL)
+            {
+                rows[num_deleted] = row;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            num_deleted++;
+        }
+        /* Otherwise keep it as the node before the next student */
+        else
+        {
+            pre_temp = temp;
+        }
+        temp = next;
+        row++;
+    }
+    /* Remove the rows of the deleted students from the columns */
+    removeStudentColumnRows(&student_columns, rows, (uint32_t)num_deleted);
+    free(rows);
+    /* Free the hash set */
+    freeStudentIndex(&targets);
+    unlockListExclusive();
+    /* Return the number of students deleted */
+    return num_deleted;
+}
+
+/**
+ * @brief Removes a student from every index of the list.
+ *
+ * This function removes a student from the ID index, the account index, the name index and the score index,
+ * and invalidates the sorted views which still hold it. Unlinking a student keeps the order of the others,
+ * so the list stays in the order of a view and that view is refilled by the next sort without sorting.
+ *
+ * @param student The student to be removed.
+ */
+static void removeStudentFromIndexes(Student_t *student)
+{
+    removeStudentFromIndex(&id_index, student);
+    removeStudentFromIndex(&account_index, student);
+    removeStudentFromNameIndex(student);
+    removeStudentFromScoreIndex(&score_index, student);
+    score_view.is_valid = 0;
+    name_view.is_valid = 0;
+    position_view.is_valid = 0;
+}
+
+/**
+ * @brief Sorts the linked list by the given comparison function.
+ *
+ * This function sorts the linked list with a stable merge sort, nothing happens if the list is a read-only
+ * snapshot. The students are relinked by their next pointers only, so no data of the students is copied.
+ * A large list is cut into one segment per thread set by setSortThreads, the segments are sorted and then
+ * merged pairwise on separate threads.
+ * The head, the tail and the columns of the list are updated when the sort is done.
+ *
+ * @param compare The function which compares two students, it is called from several threads at once.
+ */
+void sortList(StudentCompare_t compare)
+{
+    lockListExclusive();
+    /* A list of less than two students is already sorted, a read-only snapshot cannot be sorted */
+    if ((student_list.count > 1) && (mapped_header == NULL))
+    {
+        /* Sort the students and update the head and the tail of the list */
+        student_list.head = sortStudentChainParallel(student_list.head, student_list.count, compare,
+                                                     sort_threads, &student_list.tail);
+        /* The order of compare is not kept by any sorted view */
+        list_order = NULL;
+        position_view.is_valid = 0;
+        buildStudentColumns(&student_columns, student_list.head, (uint32_t)student_list.count);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListExclusive();
+}
+
+/**
+ * @brief Sets the number of threads used to sort the list.
+ *
+ * The default is 1, so the list is sorted on the calling thread.
+ *
+ * @param num_threads The number of threads, it is clamped between 1 and LIST_SORT_MAX_THREADS.
+ */
+void setSortThreads(int32_t num_threads)
+{
+    lockListExclusive();
+    sort_threads = (num_threads < 1) ? 1 : ((num_threads > LIST_SORT_MAX_THREADS) ? LIST_SORT_MAX_THREADS : num_threads);
+    unlockListExclusive();
+}
+
+/**
+ * @brief Gets the number of threads used to sort the list.
+ *
+ * @return The number of threads used to sort the list.
+ */
+int32_t getSortThreads(void)
+{
+    int32_t num_threads = 0;    /* The number of threads of the sorts */
+
+    lockListShared();
+    num_threads = sort_threads;
+    unlockListShared();
+    /* Return the number of threads */
+    return num_threads;
+}
+
+/**
+ * @brief Sets the number of threads used to scan the list by findStudentsByName.
+ *
+ * The default is 1, so the list is scanned on the calling thread.
+ *
+ * @param num_threads The number of threads, it is clamped between 1 and STUDENT_SCAN_MAX_THREADS.
+ */
+void setSearchThreads(int32_t num_threads)
+{
+    lockListExclusive();
+    search_threads = (num_threads < 1) ? 1 : ((num_threads > STUDENT_SCAN_MAX_THREADS) ? STUDENT_SCAN_MAX_THREADS : num_threads);
+    unlockListExclusive();
+}
+
+/**
+ * @brief Gets the number of threads used to scan the list.
+ *
+ * @return The number of threads used to scan the list.
+ */
+int32_t getSearchThreads(void)
+{
+    int32_t num_threads = 0;    /* The number of threads of the scans */
+
+    lockListShared();
+    num_threads = search_threads;
+    unlockListShared();
+    /* Return the number of threads */
+    return num_threads;
+}
+
+/**
+ * @brief Enables or disables the columnar storage of the list.
+ *
+ * When it is enabled, the average scores of the students are also stored in a contiguous column
+ * in the order of the list, which is built from the current list at once and then follows every addition,
+ * deletion and sort. sortByScore and countStudentsByScoreRange then read the column instead of the nodes.
+ * It is disabled by default, and it is disabled again if the memory of the column cannot be allocated.
+ *
+ * @param is_enabled 1 to enable the columnar storage, 0 to disable it.
+ */
+void setColumnarStorage(int32_t is_enabled)
+{
+    lockListExclusive();
+    enableStudentColumns(&student_columns, is_enabled, student_list.head, (uint32_t)student_list.count);
+    unlockListExclusive();
+}
+
+/**
+ * @brief Checks if the columnar storage of the list is enabled.
+ *
+ * @return 1 if the columnar storage is enabled, 0 otherwise.
+ */
+int32_t is_List_Columnar(void)
+{
+    int32_t is_columnar = 0;    /* 1 if the columnar storage is enabled, 0 otherwise */
+
+    lockListShared();
+    is_columnar = student_columns.is_enabled;
+    unlockListShared();
+    /* Return the value of is_columnar */
+    return is_columnar;
+}
+
+/**
+ * @brief Enables or disables the concurrent access to the list.
+ *
+ * The reading functions take the lock of the list shared and the changing functions take it exclusive.
+ * A function called by another function of the list on the same thread does not wait for the lock.
+ * The kernel of the statistics is chosen here, so the readers never choose it at the same time.
+ *
+ * @param is_enabled 1 to enable the concurrent access, 0 to disable it.
+ */
+void setConcurrentAccess(int32_t is_enabled)
+{
+    (void)getScoreStatsKernel();
+    enableListLock(is_enabled);
+}
+
+/**
+ * @brief Checks if the concurrent access to the list is enabled.
+ *
+ * @return 1 if the concurrent access is enabled, 0 otherwise.
+ */
+int32_t is_List_Concurrent(void)
+{
+    return is_ListLock_Enabled();
+}
+
+/**
+ * @brief Sorts the linked list by student's average score.
+ *
+ * This function sorts the linked list by student's average score in descending order, nothing happens
+ * if the list is a read-only snapshot.
+ * The students are sorted in linear time by a radix sort of their encoded average scores,
+ * students having the same average score keep their order.
+ * The order is kept in a sorted view until a student is added or deleted, so sorting an unchanged list
+ * again only relinks the students when no two of them have the same average score, or does nothing if the list
+ * is still in that order. Otherwise the list is sorted again, so the students keep their current order.
+ */
+void sortByScore(void)
+{
+    lockListExclusive();
+    /* A list of less than two students is already sorted, a read-only snapshot cannot be sorted */
+    if ((student_list.count > 1) && (mapped_header == NULL))
+    {
+        sortByView(&score_view, compareByScore);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListExclusive();
+}
+
+/**
+ * @brief Sorts the linked list by student's name.
+ *
+ * This function sorts the list of students by their name in ascending order with the merge sort of sortList,
+ * students having the same name keep their order.
+ * The order is kept in a sorted view until a student is added or deleted, so sorting an unchanged list
+ * again only relinks the students when no two of them have the same name, or does nothing if the list
+ * is still in that order. Otherwise the list is sorted again, so the students keep their current order.
+ */
+void sortByName(void)
+{
+    lockListExclusive();
+    /* A list of less than two students is already sorted, a read-only snapshot cannot be sorted */
+    if ((student_list.count > 1) && (mapped_header == NULL))
+    {
+        sortByView(&name_view, compareByName);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListExclusive();
+}
+
+/**
+ * @brief Sorts the list in the order of a sorted view.
+ *
+ * This function does nothing to the list if it is already in the order of the view. Otherwise the list
+ * is relinked from the view if the view is valid, or sorted with compare if it is not: the score order
+ * by a radix sort, of the score column when the columns are enabled, the name order by the merge sort
+ * of sortList. The columns are rebuilt in the new order of the list.
+ * An invalid view is then refilled from the sorted list in one traversal.
+ * Relinking a view in which two students have the same key would give them the order they had when
+ * the view was filled instead of their current order, so such a view is dropped and the list is sorted
+ * again, which keeps the sort stable.
+ *
+ * @param view The view of the order, score_view or name_view.
+ * @param compare The function which compares two students in the order of the view.
+ */
+static void sortByView(SortedView_t *view, StudentCompare_t compare)
+{
+    Student_t *first = NULL;        /* The first student of the list sorted from its columns */
+    int32_t is_relinked = 0;        /* 1 if the list is relinked and its columns are out of order */
+    int32_t is_refilled = 0;        /* 1 if the view is filled again from the sorted list */
+
+    /* Only a view without ties gives the order of a stable sort of the list in any order */
+    if ((list_order != view) && (view->is_tie_free == 0))
+    {
+        view->is_valid = 0;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Put the list in the order of the view */
+    if (list_order == view)
+    {
+        /* Do nothing */
+    }
+    else if (view->is_valid)
+    {
+        student_list.head = linkSortedView(view, &student_list.tail);
+        is_relinked = 1;
+    }
+    else if (view == &score_view)
+    {
+        /* Sort the columns if they are enabled, they stay in the order of the list */
+        if (student_columns.is_enabled)
+        {
+            first = sortStudentColumnsByScore(student_columns.scores, student_columns.students,
+                                              student_list.count, &student_list.tail);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if (first != NULL)
+        {
+            student_list.head = first;
+        }
+        else
+        {
+            student_list.head = sortStudentChainByScore(student_list.head, student_list.count, compare,
+                                                        &student_list.tail);
+            is_relinked = 1;
+        }
+    }
+    else
+    {
+        student_list.head = sortStudentChainParallel(student_list.head, student_list.count, compare,
+                                                     sort_threads, &student_list.tail);
+        is_relinked = 1;
+    }
+    /* The position view is only still valid if the list was already in the order of the view */
+    position_view.is_valid = (list_order == view) ? position_view.is_valid : 0;
+    list_order = view;
+
+    /* Refill the view from the student column if it is in the order of the list, otherwise from the list */
+    if ((view->is_valid == 0) && student_columns.is_enabled && (is_relinked == 0))
+    {
+        is_refilled = copySortedView(view, student_columns.students, student_list.count);
+    }
+    else if (view->is_valid == 0)
+    {
+        is_refilled = fillSortedView(view, student_list.head, student_list.count);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Check a refilled view for ties once, it is only relinked later if it has none */
+    if (is_refilled)
+    {
+        markSortedViewTies(view, compare);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Rebuild the columns of a relinked list from the view, whose students are read without following the list */
+    if (is_relinked && view->is_valid)
+    {
+        copyStudentColumns(&student_columns, view->students, (uint32_t)student_list.count);
+    }
+    else if (is_relinked)
+    {
+        buildStudentColumns(&student_columns, student_list.head, (uint32_t)student_list.count);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Searching for an student's information by their ID.
+ *
+ * This function searches for a student's information by their ID.
+ * The student is looked up in the ID index,
+ * it displays the information of the student if found.
+ *
+ * @param ID The ID of the student to be searched.
+ */
+void searchInfoByID(int8_t *ID)
+{
+    Student_t* temp = NULL;     /* The student having the input ID */
+
+    lockListShared();
+    temp = findStudentInIndex(&id_index, ID);
+
+    /* If a read-only snapshot is opened, display its matching records */
+    if (mapped_header != NULL)
+    {
+        showMappedMatches(STUDENT_FIELD_ID, ID);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* If the ID is on the list */
+    if (temp != NULL)
+    {
+        /* Display the information of the student */
+        showStudentInfo(temp);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListShared();
+}
+
+/**
+ * @brief Searching for an student's information by their name.
+ *
+ * This function searches for an student's information by their name.
+ * The students having the input name are found in the name index and displayed in the order in which
+ * they were added to the list.
+ *
+ * @param name The name of the student to be searched.
+ */
+void searchInfoByName(int8_t *name)
+{
+    const NameEntry_t *entry = NULL;    /* The entry of the input name in the name index */
+    uint32_t i = 0;                     /* Position of each student of the entry */
+
+    lockListShared();
+
+    /* If a read-only snapshot is opened, display its matching records */
+    if (mapped_header != NULL)
+    {
+        showMappedMatches(STUDENT_FIELD_NAME, name);
+    }
+    else
+    {
+        entry = findNameEntry(findPooledString(name));
+    }
+
+    /* Display every student having the input name, skipping the positions of the removed students */
+    for (i = 0; (entry != NULL) && (i < entry->length); i++)
+    {
+        if (entry->students[i] != NULL)
+        {
+            showStudentInfo(entry->students[i]);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    unlockListShared();
+}
+
+/**
+ * @brief Searching for the students whose name starts with or contains a pattern.
+ *
+ * This function finds the matching names in the trigram index of the names, so only the names sharing
+ * the rarest trigram of the pattern are compared. The students of each matching name are displayed in the
+ * order in which they were added to the list.
+ * If a read-only snapshot is opened, its records are scanned instead.
+ *
+ * @param pattern The pattern to be found.
+ * @param match NAME_MATCH_PREFIX or NAME_MATCH_SUBSTRING.
+ * @return The number of students displayed.
+ */
+int32_t searchInfoByNamePattern(int8_t *pattern, NameMatch_t match)
+{
+    const NameEntry_t **entries = NULL;     /* The entries of the matching names */
+    const int8_t *name = NULL;              /* The name of each record of the read-only snapshot */
+    size_t length = strlen(pattern);        /* The number of characters of the pattern */
+    uint32_t num_entries = 0;               /* The number of matching names */
+    int32_t num_found = 0;                  /* The number of students displayed */
+    int32_t is_match = 0;                   /* 1 if the name of the record matches the pattern */
+    uint32_t i = 0;                         /* Position of each matching name or of each record */
+    uint32_t j = 0;                         /* Position of each student of a matching name */
+
+    lockListShared();
+
+    /* If a read-only snapshot is opened, display its matching records */
+    if (mapped_header != NULL)
+    {
+        for (i = 0; i < mapped_header->count; i++)
+        {
+            name = getMappedName(&mapped_records[i]);
+            if (match == NAME_MATCH_PREFIX)
+            {
+                is_match = (strncmp(name, pattern, length) == 0) ? 1 : 0;
+            }
+            else
+            {
+                is_match = (strstr(name, pattern) != NULL) ? 1 : 0;
+            }
+            if (is_match)
+            {
+                showRecordInfo(mapped_records[i].ID, name, mapped_records[i].account, mapped_records[i].average_score);
+                num_found++;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    else
+    {
+        /* Display the students of every matching name */
+        entries = findNameEntries(pattern, match, &num_entries);
+        for (i = 0; i < num_entries; i++)
+        {
+            for (j = 0; j < entries[i]->length; j++)
+            {
+                if (entries[i]->students[j] != NULL)
+                {
+                    showStudentInfo(entries[i]->students[j]);
+                    num_found++;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+        }
+        free(entries);
+    }
+    unlockListShared();
+    /* Return the number of students displayed */
+    return num_found;
+}
+
+/**
+ * @brief Searching for an student's information by their account.
+ *
+ * This function searches for an student's information by their account.
+ * The accounts are unique, so the student is looked up in the account index and displayed if found.
+ * If a read-only snapshot is opened, its matching records are scanned instead.
+ *
+ * @param account The account of the student to be searched.
+ */
+void searchInfoByAcc(int8_t *account)
+{
+    Student_t *temp = NULL;             /* The student having the input account */
+
+    lockListShared();
+
+    /* If a read-only snapshot is opened, display its matching records */
+    if (mapped_header != NULL)
+    {
+        showMappedMatches(STUDENT_FIELD_ACCOUNT, account);
+    }
+    else
+    {
+        temp = findStudentInIndex(&account_index, account);
+    }
+
+    /* If the account is on the list */
+    if (temp != NULL)
+    {
+        /* Display the information of the student */
+        showStudentInfo(temp);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListShared();
+}
+
+/**
+ * @brief Finds the students having a name.
+ *
+ * This function looks up the name in the string pool, so a name which no student has is not scanned for,
+ * and scans the list comparing the name offset of each student with the one of the name.
+ * The name index is not used because it keeps the students in the order in which they were added,
+ * not in the order of the list.
+ *
+ * @param name The name to be found.
+ * @param result Pointer to a result set which receives the students found, freed by freeStudentResultSet.
+ * @return The number of students found, -1 if the memory of the result set cannot be allocated.
+ */
+int32_t findStudentsByName(const int8_t *name, StudentResultSet_t *result)
+{
+    Student_t probe;                    /* The student whose name is searched */
+    int32_t num_found = 0;              /* The number of students found */
+
+    result->students = NULL;
+    result->count = 0;
+    result->capacity = 0;
+    lockListShared();
+    probe.name_offset = findPooledString(name);
+
+    /* If the name is in the pool and the list is not a read-only snapshot */
+    if ((probe.name_offset != STRING_POOL_NONE) && (mapped_header == NULL))
+    {
+        num_found = findStudents(matchStudentName, &probe, result);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListShared();
+    /* Return the number of students found */
+    return num_found;
+}
+
+/**
+ * @brief Finds the students having an account.
+ *
+ * This function looks the account up in the account index. The accounts are unique, so the result set
+ * receives at most one student.
+ *
+ * @param account The account to be found.
+ * @param result Pointer to a result set which receives the students found, freed by freeStudentResultSet.
+ * @return The number of students found, -1 if the memory of the result set cannot be allocated.
+ */
+int32_t findStudentsByAccount(const int8_t *account, StudentResultSet_t *result)
+{
+    Student_t *student = NULL;          /* The student having the account */
+    int32_t num_found = 0;              /* The number of students found */
+
+    result->students = NULL;
+    result->count = 0;
+    result->capacity = 0;
+    lockListShared();
+
+    /* If the list is not a read-only snapshot */
+    if (mapped_header == NULL)
+    {
+        student = findStudentInIndex(&account_index, account);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* If the account is on the list */
+    if (student != NULL)
+    {
+        result->students = (Student_t **)malloc(sizeof(Student_t *));
+        if (result->students != NULL)
+        {
+            result->students[0] = student;
+            result->count = 1;
+            result->capacity = 1;
+            num_found = 1;
+        }
+        else
+        {
+            num_found = -1;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListShared();
+    /* Return the number of students found */
+    return num_found;
+}
+
+/**
+ * @brief Frees the students of a result set.
+ *
+ * @param result The result set, it is empty afterwards.
+ */
+void freeStudentResultSet(StudentResultSet_t *result)
+{
+    free(result->students);
+    result->students = NULL;
+    result->count = 0;
+    result->capacity = 0;
+}
+
+/**
+ * @brief Searching for the students whose average score is in a range.
+ *
+ * This function displays the students whose average score is between min_score and max_score,
+ * from the highest to the lowest average score. The first student of the range is found in the score index,
+ * then the following students are visited until the average score is lower than min_score,
+ * so only O(log n + k) students are visited for k matching students.
+ * If a read-only snapshot is opened, its records are scanned instead.
+ *
+ * @param min_score The lowest average score of the range.
+ * @param max_score The highest average score of the range.
+ * @return The number of students displayed.
+ */
+int32_t searchInfoByScoreRange(float min_score, float max_score)
+{
+    const ScoreNode_t *node = NULL;     /* Each student of the range in the score index */
+    int32_t num_found = 0;              /* The number of students displayed */
+    uint32_t i = 0;                     /* Position of each record of the read-only snapshot */
+
+    lockListShared();
+    node = findScoreNode(&score_index, max_score);
+
+    /* If a read-only snapshot is opened, display its records in the range */
+    if (mapped_header != NULL)
+    {
+        for (i = 0; i < mapped_header->count; i++)
+        {
+            if ((mapped_records[i].average_score >= min_score) && (mapped_records[i].average_score <= max_score))
+            {
+                showRecordInfo(mapped_records[i].ID, getMappedName(&mapped_records[i]),
+                               mapped_records[i].account, mapped_records[i].average_score);
+                num_found++;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Display the students until the average score is lower than the range */
+    while ((node != NULL) && (node->student->average_score >= min_score))
+    {
+        showStudentInfo(node->student);
+        num_found++;
+        node = node->next[0];
+    }
+    unlockListShared();
+    /* Return the number of students displayed */
+    return num_found;
+}
+
+/**
+ * @brief Counts the students whose average score is in a range.
+ *
+ * This function counts the students whose average score is between min_score and max_score without
+ * displaying them. With the columnar storage the score column is scanned at memory bandwidth,
+ * otherwise the range is walked in the score index. If a read-only snapshot is opened, its records
+ * are scanned instead.
+ *
+ * @param min_score The lowest average score of the range.
+ * @param max_score The highest average score of the range.
+ * @return The number of students whose average score is in the range.
+ */
+int32_t countStudentsByScoreRange(float min_score, float max_score)
+{
+    const ScoreNode_t *node = NULL;     /* Each student of the range in the score index */
+    int32_t num_found = 0;              /* The number of students in the range */
+    uint32_t i = 0;                     /* Position of each record of the read-only snapshot */
+
+    lockListShared();
+
+    /* If a read-only snapshot is opened, count its records in the range */
+    if (mapped_header != NULL)
+    {
+        for (i = 0; i < mapped_header->count; i++)
+        {
+            num_found += ((mapped_records[i].average_score >= min_score) &&
+                          (mapped_records[i].average_score <= max_score)) ? 1 : 0;
+        }
+    }
+    /* If the columnar storage is enabled, scan the score column */
+    else if (student_columns.is_enabled)
+    {
+        num_found = (int32_t)countStudentColumnScores(&student_columns, min_score, max_score);
+    }
+    /* Otherwise walk the range in the score index */
+    else
+    {
+        node = findScoreNode(&score_index, max_score);
+        while ((node != NULL) && (node->student->average_score >= min_score))
+        {
+            num_found++;
+            node = node->next[0];
+        }
+    }
+    unlockListShared();
+    /* Return the number of students in the range */
+    return num_found;
+}
+
+/**
+ * @brief Computes the statistics of the average scores of the list.
+ *
+ * This function accumulates the score column at once when the columnar storage is enabled. Otherwise the
+ * average scores of the students, or of the records of a read-only snapshot, are copied into a buffer on
+ * the stack which is accumulated each time it is full, so the vector kernel also runs on the linked list.
+ *
+ * @param statistics Pointer to a structure which receives the statistics, every field is 0 for an empty list.
+ * @return The number of students.
+ */
+int32_t computeClassStatistics(ClassStatistics_t *statistics)
+{
+    float scores[SCORE_STATS_CHUNK_SIZE];   /* The buffer of gathered average scores */
+    ScoreStats_t stats;                 /* The accumulated statistics */
+    Student_t *temp = NULL;             /* Temporary pointer to traverse the list */
+    uint32_t num_scores = 0;            /* The number of average scores in the buffer */
+    uint32_t i = 0;                     /* Position of each record of the read-only snapshot */
+
+    lockListShared();
+    temp = student_list.head;
+
+    initScoreStats(&stats);
+    /* If a read-only snapshot is opened, gather the average scores of its records */
+    if (mapped_header != NULL)
+    {
+        for (i = 0; i < mapped_header->count; i++)
+        {
+            scores[num_scores] = mapped_records[i].average_score;
+            num_scores++;
+            if (num_scores == SCORE_STATS_CHUNK_SIZE)
+            {
+                accumulateScoreStats(&stats, scores, num_scores);
+                num_scores = 0;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    /* If the columnar storage is enabled, the average scores are already contiguous */
+    else if (student_columns.is_enabled)
+    {
+        accumulateScoreStats(&stats, student_columns.scores, student_columns.count);
+    }
+    /* Otherwise gather the average scores of the list */
+    else
+    {
+        while (temp != NULL)
+        {
+            scores[num_scores] = temp->average_score;
+            num_scores++;
+            if (num_scores == SCORE_STATS_CHUNK_SIZE)
+            {
+                accumulateScoreStats(&stats, scores, num_scores);
+                num_scores = 0;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            temp = temp->next;
+        }
+    }
+    /* Accumulate the average scores left in the buffer */
+    accumulateScoreStats(&stats, scores, num_scores);
+    finishScoreStats(&stats, statistics);
+    unlockListShared();
+    /* Return the number of students */
+    return statistics->num_students;
+}
+
+/**
+ * @brief Displays the students having the highest average scores.
+ *
+ * This function displays the first k students of the score index, from the highest average score.
+ * Students having the same average score are displayed by ascending ID.
+ * If a read-only snapshot is opened, its records are scanned instead.
+ *
+ * @param k The number of students to be displayed.
+ * @return The number of students displayed, less than k if the list has fewer students.
+ */
+int32_t showTopStudentsByScore(int32_t k)
+{
+    const ScoreNode_t *node = NULL;     /* Each student from the highest average score */
+    int32_t num_found = 0;              /* The number of students displayed */
+
+    lockListShared();
+    node = (score_index.head != NULL) ? score_index.head->next[0] : NULL;
+
+    /* If a read-only snapshot is opened, display its best records */
+    if (mapped_header != NULL)
+    {
+        num_found = showMappedTopScores(k);
+    }
+    else
+    {
+        /* Display the first k students of the score index */
+        while ((node != NULL) && (num_found < k))
+        {
+            showStudentInfo(node->student);
+            num_found++;
+            node = node->next[0];
+        }
+    }
+    unlockListShared();
+    /* Return the number of students displayed */
+    return num_found;
+}
+
+/**
+ * @brief Displays the information of a student.
+ *
+ * This function displays the information of a student.
+ * It takes a pointer to a student as an argument.
+ *
+ * @param student The pointer to the student whose information is to be displayed.
+ */
+static void showStudentInfo(Student_t *student)
+{
+    showRecordInfo(student->ID, getStudentName(student), student->account, student->average_score);
+}
+
+/**
+ * @brief Displays the information of a student given field by field.
+ *
+ * @param ID The ID of the student.
+ * @param name The name of the student.
+ * @param account The account of the student.
+ * @param average_score The average score of the student.
+ */
+static void showRecordInfo(const int8_t *ID, const int8_t *name, const int8_t *account, float average_score)
+{
+    printf("\n-----\n");
+    printf("ID: %.*s\n", STUDENT_KEY_SIZE - 1, ID);
+    printf("Name: %s\n", name);
+    printf("Account: %.*s\n", STUDENT_KEY_SIZE - 1, account);
+    printf("Average score: %.2f\n", average_score);
+    printf("-----\n");
+}
+
+/**
+ * @brief Gets the ID of a student, used as the key of the ID index.
+ *
+ * @param student The pointer to the student.
+ * @return The ID of the student.
+ */
+static const int8_t *getStudentID(const Student_t *student)
+{
+    return student->ID;
+}
+
+/**
+ * @brief Gets the account of a student, used as the key of the account index.
+ *
+ * @param student The pointer to the student.
+ * @return The account of the student.
+ */
+static const int8_t *getStudentAccount(const Student_t *student)
+{
+    return student->account;
+}
+
+/**
+ * @brief Gets the hash value of the ID of a student, used by the ID index.
+ *
+ * @param student The pointer to the student.
+ * @return The hash value of the ID of the student.
+ */
+static uint32_t getStudentIDHash(const Student_t *student)
+{
+    return student->id_hash;
+}
+
+/**
+ * @brief Gets the hash value of the account of a student, used by the account index.
+ *
+ * @param student The pointer to the student.
+ * @return The hash value of the account of the student.
+ */
+static uint32_t getStudentAccountHash(const Student_t *student)
+{
+    return student->account_hash;
+}
+
+/**
+ * @brief Checks if a student has the name of a probe, used by findStudentsByName.
+ *
+ * Equal names share the same offset in the string pool, so only the offsets are compared.
+ *
+ * @param student The student to be checked.
+ * @param probe The student whose name offset is searched.
+ * @return 1 if the student has the name, 0 otherwise.
+ */
+static int32_t matchStudentName(const Student_t *student, const Student_t *probe)
+{
+    return (student->name_offset == probe->name_offset) ? 1 : 0;
+}
+
+/**
+ * @brief Scans the list for the students matching a probe.
+ *
+ * With the columnar storage, the column of students gives the students in the order of the list,
+ * so it is scanned on the threads set by setSearchThreads. Otherwise a list long enough for two parts
+ * is scanned from the position view, which is filled by the first parallel scan after the list changed.
+ * A single thread follows the list instead, filling the view would cost as much as the scan.
+ * The result set is freed if its memory cannot be allocated. The caller holds the lock of the list.
+ *
+ * @param match The function which checks each student.
+ * @param probe The student which the students are matched with.
+ * @param result Pointer to a result set which receives the students found.
+ * @return The number of students found, -1 if the memory of the result set cannot be allocated.
+ */
+static int32_t findStudents(StudentMatch_t match, const Student_t *probe, StudentResultSet_t *result)
+{
+    int32_t is_complete = 0;            /* 1 if every matching student is in the result set */
+    int32_t num_found = -1;             /* The number of students found */
+
+    if (student_columns.is_enabled)
+    {
+        is_complete = scanStudentArray(student_columns.students, student_columns.count, match, probe,
+                                       search_threads, result);
+    }
+    else if ((search_threads > 1) && ((uint32_t)student_list.count >= (2u * STUDENT_SCAN_MIN_PART)) &&
+             fillPositionView())
+    {
+        is_complete = scanStudentArray(position_view.students, (uint32_t)position_view.count, match, probe,
+                                       search_threads, result);
+    }
+    else
+    {
+        is_complete = scanStudentChain(student_list.head, match, probe, result);
+    }
+
+    if (is_complete)
+    {
+        num_found = (int32_t)result->count;
+    }
+    else
+    {
+        freeStudentResultSet(result);
+    }
+    /* Return the number of students found */
+    return num_found;
+}
+
+/**
+ * @brief Fills the position view from the list if it is not valid.
+ *
+ * The view is filled by a reader of the list, so the readers scanning at the same time take the position lock,
+ * and only the first one of them follows the list. The view then stays valid for every reader until a writer
+ * changes the list or its order, which cannot happen while a reader holds the lock of the list.
+ *
+ * @return 1 if the position view is valid, 0 if the memory of its array cannot be allocated.
+ */
+static int32_t fillPositionView(void)
+{
+    int32_t is_valid = 0;               /* 1 if the position view is valid */
+
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&position_lock);
+#else
+    pthread_mutex_lock(&position_lock);
+#endif
+    if (position_view.is_valid == 0)
+    {
+        (void)fillSortedView(&position_view, student_list.head, student_list.count);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    is_valid = position_view.is_valid;
+#ifdef _WIN32
+    ReleaseSRWLockExclusive(&position_lock);
+#else
+    pthread_mutex_unlock(&position_lock);
+#endif
+    /* Return 1 if the position view is valid */
+    return is_valid;
+}
+
+/**
+ * @brief Compares two students by their average score in descending order.
+ *
+ * @param first The first student.
+ * @param second The second student.
+ * @return A negative value if first has a higher average score, a positive value if it has a lower one, 0 otherwise.
+ */
+static int32_t compareByScore(const Student_t *first, const Student_t *second)
+{
+    return (int32_t)(first->average_score < second->average_score) -
+           (int32_t)(first->average_score > second->average_score);
+}
+
+/**
+ * @brief Compares two students by their name in ascending order.
+ *
+ * @param first The first student.
+ * @param second The second student.
+ * @return The result of strcmp on the names of the two students.
+ */
+static int32_t compareByName(const Student_t *first, const Student_t *second)
+{
+    int32_t result = 0;     /* Initialize result to 0, interned names having the same offset are equal */
+
+    /* Only compare the characters of names having different offsets */
+    if (first->name_offset != second->name_offset)
+    {
+        result = strcmp(getStudentName(first), getStudentName(second));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the result of the comparison */
+    return result;
+}
+
+/**
+ * @brief Displays the list of students.
+ *
+ * This function displays the list of students that includes student's ID, student's name,
+ * student's account and student's average score.
+ * It writes the list to the standard output in the block layout of showStudentInfo with writeListStudents,
+ * which is much faster than calling showStudentInfo for each student (node).
+ */
+void showListStudents(void)
+{
+    ListOutputResult_t result;      /* The result of writing the list, not used */
+
+    (void)writeListStudents(stdout, OUTPUT_FORMAT_BLOCK, &result);
+}
+
+/**
+ * @brief Writes the list of students to a stream in a format.
+ *
+ * This function traverses the records of the read-only snapshot if one is opened, otherwise the linked list,
+ * and writes every student with the buffered writer of list_output.c. The time is measured with clock()
+ * like the import of a CSV file.
+ *
+ * @param stream The stream which receives the list.
+ * @param format The format of the list.
+ * @param result Pointer to a structure which receives the number of students and bytes written and the throughput.
+ * @return 1 if the whole list is written, 0 if a write failed.
+ */
+int32_t writeListStudents(FILE *stream, OutputFormat_t format, ListOutputResult_t *result)
+{
+    ListOutput_t output;                        /* The buffered writer */
+    Student_t *student = NULL;                  /* Temporary pointer to traverse the list */
+    clock_t start = clock();                    /* The time when the writing starts */
+    int32_t is_written = 0;                     /* 1 if the whole list is written */
+    uint32_t i = 0;                             /* Index of each record of the snapshot */
+
+    lockListExclusive();
+    student = student_list.head;
+
+    result->num_students = 0;
+    beginListOutput(&output, stream, format);
+    /* If a read-only snapshot is opened, write its records */
+    if (mapped_header != NULL)
+    {
+        for (i = 0; i < mapped_header->count; i++)
+        {
+            writeRecordToOutput(&output, mapped_records[i].ID, getMappedName(&mapped_records[i]),
+                                mapped_records[i].account, mapped_records[i].average_score);
+        }
+        result->num_students = (int32_t)mapped_header->count;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    while (student != NULL)
+    {
+        writeRecordToOutput(&output, student->ID, getStudentName(student), student->account,
+                            student->average_score);
+        result->num_students++;
+        student = student->next;
+    }
+    is_written = endListOutput(&output);
+
+    /* Compute the throughput */
+    result->num_bytes = output.num_bytes;
+    result->seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    result->megabytes_per_second = (result->seconds > 0.0) ? ((double)result->num_bytes / 1e6 / result->seconds) : 0.0;
+    unlockListExclusive();
+    /* Return the value of is_written */
+    return is_written;
+}
+
+/**
+ * @brief Saves the list of students to a snapshot file.
+ *
+ * This function packs the records of the students into one buffer and writes the header, the records
+ * and the buffer of names with one call each. The buffer of names is a compact copy of the string pool
+ * holding only the names of the students, so the names of deleted students are not saved.
+ * The file is only opened once the lock is taken and the records are packed, so a file is not truncated
+ * when the memory of the records cannot be allocated.
+ *
+ * @param path The path of the snapshot file.
+ * @return 1 if the snapshot is saved, 0 otherwise.
+ */
+int32_t saveListToFile(const char *path)
+{
+    int32_t is_saved = 0;                                   /* Initialize is_saved to 0 */
+    FILE *file = NULL;                                      /* The snapshot file */
+    SnapshotHeader_t header = {SNAPSHOT_MAGIC, SNAPSHOT_VERSION, 0, 0, 0, 0};     /* The header of the snapshot */
+    SnapshotRecord_t *records = NULL;                       /* The packed records of the students */
+    StringPoolCopy_t names = {NULL, 0, NULL};               /* The compact buffer of names */
+    Student_t *temp = NULL;                                 /* Temporary pointer to traverse the list */
+    uint32_t i = 0;                                         /* Index of each record */
+
+    lockListShared();
+
+    /* If a read-only snapshot is opened, write it as it is */
+    if (mapped_header != NULL)
+    {
+        file = fopen(path, "wb");
+        if (file != NULL)
+        {
+            is_saved = (fwrite(mapped_header, 1, mapped_size, file) == mapped_size) ? 1 : 0;
+            if (fclose(file) != 0)
+            {
+                is_saved = 0;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if (beginStringPoolCopy(&names))
+    {
+        header.count = (uint32_t)student_list.count;
+        records = (SnapshotRecord_t *)calloc((header.count > 0) ? header.count : 1, sizeof(SnapshotRecord_t));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* If the records are allocated, pack them and write the snapshot */
+    if (records != NULL)
+    {
+        /* Pack the record of every student */
+        temp = student_list.head;
+        while (temp != NULL)
+        {
+            memcpy(records[i].ID, temp->ID, STUDENT_KEY_SIZE);
+            memcpy(records[i].account, temp->account, STUDENT_KEY_SIZE);
+            records[i].average_score = temp->average_score;
+            records[i].name_offset = copyPooledString(&names, temp->name_offset);
+            i++;
+            temp = temp->next;
+        }
+        header.names_size = names.size;
+
+        /* Compute the checksum of the records and of the names */
+        header.checksum = computeChecksum((const uint8_t *)records, (size_t)header.count * sizeof(SnapshotRecord_t), 2166136261u);
+        header.checksum = computeChecksum((const uint8_t *)names.data, header.names_size, header.checksum);
+
+        /* Write the header, the records and the names */
+        file = fopen(path, "wb");
+        if (file != NULL)
+        {
+            if ((fwrite(&header, sizeof(header), 1, file) == 1) &&
+                (fwrite(records, sizeof(SnapshotRecord_t), header.count, file) == header.count) &&
+                (fwrite(names.data, 1, header.names_size, file) == header.names_size))
+            {
+                is_saved = 1;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            /* Close the file */
+            if (fclose(file) != 0)
+            {
+                is_saved = 0;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        free(records);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    freeStringPoolCopy(&names);
+    unlockListShared();
+    /* Return the value of is_saved */
+    return is_saved;
 }
 
 /**
- * @brief Searching for an student's information by their name.
+ * @brief Loads the list of students from a snapshot file.
  *
- * This function searches for an student's information by their name.
- * If the name of the current student is equal to the input name,
- * it displays the information of the student.
+ * This function reads the whole snapshot file with one call, verifies its header and its checksum and
+ * then replaces the list of students by the records of the snapshot.
+ * The current list is kept if the snapshot is not valid. A record whose ID or account is empty
+ * or is already used by a previous record of the snapshot is skipped, so the indexes never hold
+ * two students with the same key.
+ * The names of the linked students are interned into the emptied string pool, so a name which no student
+ * of the snapshot uses is not loaded.
  *
- * @param name The name of the student to be searched.
+ * @param path The path of the snapshot file.
+ * @param num_skipped Pointer to a variable which receives the number of skipped records.
+ * @return 1 if the snapshot is loaded, 0 otherwise.
  */
-void searchInfoByName(int8_t *name)
+int32_t loadListFromFile(const char *path, int32_t *num_skipped)
 {
-    Student_t* temp = head;        /* Temporary pointer to traverse the list */
+    int32_t is_loaded = 0;                      /* Initialize is_loaded to 0 */
+    FILE *file = fopen(path, "rb");             /* The snapshot file */
+    SnapshotHeader_t header;                    /* The header of the snapshot */
+    uint8_t *payload = NULL;                    /* The records and the names of the snapshot */
+    size_t payload_size = 0;                    /* The number of bytes of the payload */
+    const SnapshotRecord_t *records = NULL;     /* The records of the snapshot */
+    const int8_t *names = NULL;                 /* The names of the snapshot */
+    Student_t *new_student = NULL;              /* The node of each loaded student */
+    uint32_t i = 0;                             /* Index of each record */
 
-    /* Traverse the linked list */
-    while (temp != NULL)
+    *num_skipped = 0;
+    lockListExclusive();
+
+    /* If the file is opened and its header is valid */
+    if ((file != NULL) && (fread(&header, sizeof(header), 1, file) == 1) &&
+        (header.magic == SNAPSHOT_MAGIC) && (header.version == SNAPSHOT_VERSION) &&
+        (header.count <= (uint32_t)INT32_MAX))
     {
-        /* If the name of temp is equal to the input name */
-        if (strcmp(temp->name, name) == 0)
+        /* Read the records and the names with one call */
+        payload_size = (size_t)header.count * sizeof(SnapshotRecord_t) + header.names_size;
+        payload = (uint8_t *)malloc((payload_size > 0) ? payload_size : 1);
+        records = (const SnapshotRecord_t *)payload;
+        names = (const int8_t *)(payload + (size_t)header.count * sizeof(SnapshotRecord_t));
+
+        if ((payload != NULL) && (fread(payload, 1, payload_size, file) == payload_size) &&
+            (computeChecksum(payload, payload_size, 2166136261u) == header.checksum) &&
+            ((header.names_size == 0) || (names[header.names_size - 1] == '\0')))
         {
-            /* Display the information of the student */
-            showStudentInfo(temp);
+            is_loaded = 1;
+            /* Every record must refer to a name inside the buffer of names */
+            for (i = 0; i < header.count; i++)
+            {
+                if (records[i].name_offset >= header.names_size)
+                {
+                    is_loaded = 0;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
         }
         else
         {
             /* Do nothing */
         }
-        /* Move to the next student */
-        temp = temp->next;
     }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* If the snapshot is valid, replace the list by its records */
+    if (is_loaded)
+    {
+        closeListSnapshot();
+        resetList();
+        /* Presize the indexes for every record */
+        reserveStudentIndex(&id_index, header.count);
+        reserveStudentIndex(&account_index, header.count);
+        for (i = 0; i < header.count; i++)
+        {
+            new_student = allocStudentNode();
+            memcpy(new_student->ID, records[i].ID, STUDENT_KEY_SIZE);
+            new_student->ID[STUDENT_KEY_SIZE - 1] = '\0';
+            memcpy(new_student->account, records[i].account, STUDENT_KEY_SIZE);
+            new_student->account[STUDENT_KEY_SIZE - 1] = '\0';
+            new_student->id_hash = hashStudentKey(new_student->ID);
+            new_student->account_hash = hashStudentKey(new_student->account);
+            new_student->average_score = records[i].average_score;
+            new_student->next = NULL;
+            /* Skip a record which cannot be told apart from another student */
+            if ((new_student->ID[0] != '\0') && (new_student->account[0] != '\0') &&
+                (checkStudentConflicts(new_student->ID, new_student->account) == STUDENT_CONFLICT_NONE))
+            {
+                new_student->name_offset = internString(&names[records[i].name_offset]);
+                linkStudentToList(new_student);
+            }
+            else
+            {
+                freeStudentNode(new_student);
+                (*num_skipped)++;
+            }
+        }
+        /* Build the score index at once */
+        buildScoreIndex(&score_index, student_list.head);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Close the file and free the payload */
+    if (file != NULL)
+    {
+        fclose(file);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    free(payload);
+    unlockListExclusive();
+    /* Return the value of is_loaded */
+    return is_loaded;
 }
 
 /**
- * @brief Searching for an student's information by their account.
+ * @brief Opens a snapshot file as a read-only list of students.
  *
- * This function searches for an student's information by their account.
- * If the account of the current student is equal to the input account,
- * it displays the information of the student.
+ * This function maps a snapshot file into memory without copying its records into nodes.
+ * While the snapshot is opened, is_List_Exist, getListSize, the is_*_Exist functions, the searchInfoBy*
+ * functions, showListStudents and saveListToFile work directly on the mapped records, and the list cannot
+ * be modified. The mapped pages are shared by every process which opens the same snapshot.
+ * Only the header and the size of the file are verified, the checksum is not, so opening is instant.
+ * The current list is released when the snapshot is opened.
  *
- * @param account The account of the student to be searched.
+ * @param path The path of the snapshot file.
+ * @return 1 if the snapshot is opened, 0 otherwise.
  */
-void searchInfoByAcc(int8_t *account)
+int32_t openListSnapshot(const char *path)
+{
+    int32_t is_opened = 0;                      /* Initialize is_opened to 0 */
+    void *view = NULL;                          /* The mapped view of the file */
+    size_t size = 0;                            /* The number of bytes of the file */
+    const SnapshotHeader_t *header = NULL;      /* The header of the snapshot */
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;         /* The file handle */
+    HANDLE mapping = NULL;                      /* The mapping handle */
+    LARGE_INTEGER file_size;                    /* The size of the file */
+
+    /* Open the file and map it read-only */
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if ((file != INVALID_HANDLE_VALUE) && GetFileSizeEx(file, &file_size) &&
+        ((uint64_t)file_size.QuadPart >= sizeof(SnapshotHeader_t)))
+    {
+        size = (size_t)file_size.QuadPart;
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping != NULL)
+        {
+            view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#else
+    int fd = open(path, O_RDONLY);              /* The file descriptor */
+    struct stat file_stat;                      /* The status of the file */
+
+    /* Open the file and map it read-only */
+    if ((fd >= 0) && (fstat(fd, &file_stat) == 0) && ((uint64_t)file_stat.st_size >= sizeof(SnapshotHeader_t)))
+    {
+        size = (size_t)file_stat.st_size;
+        view = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (view == MAP_FAILED)
+        {
+            view = NULL;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* The mapping stays valid after the file is closed */
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /* Verify the header and the size of the snapshot */
+    header = (const SnapshotHeader_t *)view;
+    if ((header != NULL) && (header->magic == SNAPSHOT_MAGIC) && (header->version == SNAPSHOT_VERSION) &&
+        (header->count <= (uint32_t)INT32_MAX) &&
+        ((uint64_t)size == sizeof(SnapshotHeader_t) + (uint64_t)header->count * sizeof(SnapshotRecord_t) + header->names_size) &&
+        ((header->names_size == 0) || (((const int8_t *)view)[size - 1] == '\0')))
+    {
+        is_opened = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* If the snapshot is valid, it replaces the list */
+    lockListExclusive();
+    if (is_opened)
+    {
+        closeListSnapshot();
+        resetList();
+        mapped_header = header;
+        mapped_records = (const SnapshotRecord_t *)(header + 1);
+        mapped_names = (const int8_t *)(mapped_records + header->count);
+        mapped_size = size;
+#ifdef _WIN32
+        mapped_file = file;
+        mapped_mapping = mapping;
+#endif
+    }
+    /* Otherwise release the mapping */
+    else
+    {
+#ifdef _WIN32
+        if (view != NULL)
+        {
+            UnmapViewOfFile(view);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if (mapping != NULL)
+        {
+            CloseHandle(mapping);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+#else
+        if (view != NULL)
+        {
+            munmap(view, size);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+#endif
+    }
+    unlockListExclusive();
+    /* Return the value of is_opened */
+    return is_opened;
+}
+
+/**
+ * @brief Closes the read-only snapshot.
+ *
+ * This function unmaps the snapshot opened by openListSnapshot, the list becomes empty.
+ * Nothing happens if no snapshot is opened.
+ */
+void closeListSnapshot(void)
+{
+    lockListExclusive();
+    /* If a snapshot is opened, unmap it */
+    if (mapped_header != NULL)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile((LPCVOID)mapped_header);
+        CloseHandle(mapped_mapping);
+        CloseHandle(mapped_file);
+        mapped_mapping = NULL;
+        mapped_file = INVALID_HANDLE_VALUE;
+#else
+        munmap((void *)mapped_header, mapped_size);
+#endif
+        mapped_header = NULL;
+        mapped_records = NULL;
+        mapped_names = NULL;
+        mapped_size = 0;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListExclusive();
+}
+
+/**
+ * @brief Checks if the list is a read-only snapshot.
+ *
+ * This function checks if a snapshot is opened by openListSnapshot.
+ * It returns 1 if the list is read-only, 0 otherwise.
+ *
+ * @return 1 if the list is read-only, 0 otherwise.
+ */
+int32_t is_List_ReadOnly(void)
+{
+    int32_t is_read_only = 0;   /* 1 if a read-only snapshot is opened, 0 otherwise */
+
+    lockListShared();
+    is_read_only = (mapped_header != NULL) ? 1 : 0;
+    unlockListShared();
+    /* Return the value of is_read_only */
+    return is_read_only;
+}
+
+/**
+ * @brief Displays the memory usage of the list of students.
+ *
+ * This function displays the number of bytes allocated for the nodes, the string pool and the indexes
+ * of the list, and the number of bytes per student.
+ */
+void showMemoryUsage(void)
+{
+    size_t node_bytes = 0;              /* Bytes of the chunks of nodes */
+    size_t string_bytes = 0;            /* Bytes of the string pool */
+    size_t index_bytes = 0;             /* Bytes of the indexes, sorted views and columns */
+    size_t total_bytes = 0;             /* Total bytes of the list */
+
+    lockListShared();
+    node_bytes = getStudentPoolBytes();
+    string_bytes = getStringPoolBytes();
+    index_bytes = ((size_t)id_index.capacity + account_index.capacity +
+                   score_view.capacity + name_view.capacity + student_columns.capacity) * sizeof(Student_t *) +
+                  (size_t)student_columns.capacity * sizeof(float) + score_index.bytes + getNameIndexBytes();
+    total_bytes = node_bytes + string_bytes + index_bytes;
+
+    printf("\nMemory usage of the list of students:\n");
+    printf("Node size: %u bytes\n", (uint32_t)sizeof(Student_t));
+    printf("Nodes: %lu bytes\n", (unsigned long)node_bytes);
+    printf("String pool: %lu bytes\n", (unsigned long)string_bytes);
+    printf("Indexes: %lu bytes\n", (unsigned long)index_bytes);
+    /* Only compute the bytes per student when the list is not empty */
+    if (student_list.count > 0)
+    {
+        printf("Bytes per student: %.1f (%.1f without indexes)\n",
+               (double)total_bytes / student_list.count,
+               (double)(node_bytes + string_bytes) / student_list.count);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    unlockListShared();
+}
+
+/**
+ * @brief Gets the name of a record of the read-only snapshot.
+ *
+ * @param record The pointer to the record.
+ * @return The name of the record, an empty string if its offset is outside of the buffer of names.
+ */
+static const int8_t *getMappedName(const SnapshotRecord_t *record)
+{
+    const int8_t *name = (const int8_t *)"";    /* Initialize name to an empty string */
+
+    /* Only trust offsets inside the buffer of names */
+    if (record->name_offset < mapped_header->names_size)
+    {
+        name = &mapped_names[record->name_offset];
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the name */
+    return name;
+}
+
+/**
+ * @brief Finds the next record of the read-only snapshot whose field is equal to a key.
+ *
+ * This function scans the mapped records from a start position and stops at the first match.
+ *
+ * @param field The field to be compared.
+ * @param key The key to be found.
+ * @param start The position of the first record to be compared.
+ * @return The position of the matching record, or the number of records if there is no match.
+ */
+static uint32_t findMappedRecord(StudentField_t field, const int8_t *key, uint32_t start)
 {
-    Student_t* temp = head;        /* Temporary pointer to traverse the list */
+    uint32_t i = start;                     /* Position of each record */
+    uint32_t count = mapped_header->count;  /* The number of records */
+    int32_t is_found = 0;                   /* Initialize is_found to 0 */
 
-    /* Traverse the linked list */
-    while (temp != NULL)
+    /* Scan the records until the key is found */
+    while ((i < count) && (is_found == 0))
     {
-        /* If the account of temp is equal to the input account */
-        if (strcmp(temp->account, account) == 0)
+        switch (field)
+        {
+            case STUDENT_FIELD_ID:
+            {
+                is_found = (strncmp(mapped_records[i].ID, key, STUDENT_KEY_SIZE) == 0) ? 1 : 0;
+                break;
+            }
+            case STUDENT_FIELD_NAME:
+            {
+                is_found = (strcmp(getMappedName(&mapped_records[i]), key) == 0) ? 1 : 0;
+                break;
+            }
+            default:
+            {
+                is_found = (strncmp(mapped_records[i].account, key, STUDENT_KEY_SIZE) == 0) ? 1 : 0;
+                break;
+            }
+        }
+        /* Only move to the next record if this one does not match */
+        if (is_found == 0)
         {
-            /* Display the information of the student */
-            showStudentInfo(temp);
+            i++;
         }
         else
         {
             /* Do nothing */
         }
-        /* Move to the next student */
-        temp = temp->next;
     }
+    /* Return the position of the matching record */
+    return i;
 }
 
 /**
- * @brief Displays the information of a student.
+ * @brief Displays every record of the read-only snapshot whose field is equal to a key.
  *
- * This function displays the information of a student.
- * It takes a pointer to a student as an argument.
+ * @param field The field to be compared.
+ * @param key The key to be found.
+ */
+static void showMappedMatches(StudentField_t field, const int8_t *key)
+{
+    uint32_t i = findMappedRecord(field, key, 0);   /* Position of each matching record */
+
+    /* Display every matching record */
+    while (i < mapped_header->count)
+    {
+        showRecordInfo(mapped_records[i].ID, getMappedName(&mapped_records[i]),
+                       mapped_records[i].account, mapped_records[i].average_score);
+        i = findMappedRecord(field, key, i + 1);
+    }
+}
+
+/**
+ * @brief Displays the records of the read-only snapshot having the highest average scores.
  *
- * @param student The pointer to the student whose information is to be displayed.
+ * This function scans the mapped records once and keeps the positions of the best k records in an array
+ * ordered like the score index, a record is only inserted into the array if it is better than the last one.
+ *
+ * @param k The number of records to be displayed.
+ * @return The number of records displayed.
  */
-static void showStudentInfo(Student_t *student)
+static int32_t showMappedTopScores(int32_t k)
 {
-    printf("\n-----\n");
-    printf("ID: %s\n", student->ID);
-    printf("Name: %s\n", student->name);
-    printf("Account: %s\n", student->account);
-    printf("Average score: %.2f\n", student->average_score);
-    printf("-----\n");
+    uint32_t capacity = (k > 0) ? (uint32_t)k : 0;     /* The number of records to be kept */
+    uint32_t *best = NULL;                  /* The positions of the best records */
+    uint32_t num_best = 0;                  /* The number of records in the array */
+    uint32_t i = 0;                         /* Position of each record */
+    uint32_t j = 0;                         /* Position in the array where the record is inserted */
+    const SnapshotRecord_t *record = NULL;  /* The current record */
+
+    /* Keep at most every record of the snapshot */
+    capacity = (capacity < mapped_header->count) ? capacity : mapped_header->count;
+    best = (uint32_t *)malloc((capacity > 0) ? (capacity * sizeof(uint32_t)) : 1);
+
+    for (i = 0; (i < mapped_header->count) && (capacity > 0); i++)
+    {
+        record = &mapped_records[i];
+        /* Find the position of the record among the best records, by descending score then ascending ID */
+        j = num_best;
+        while ((j > 0) &&
+               ((mapped_records[best[j - 1]].average_score < record->average_score) ||
+                ((mapped_records[best[j - 1]].average_score == record->average_score) &&
+                 (strncmp(mapped_records[best[j - 1]].ID, record->ID, STUDENT_KEY_SIZE) > 0))))
+        {
+            j--;
+        }
+        /* Insert the record if it is one of the best records */
+        if (j < capacity)
+        {
+            num_best = (num_best < capacity) ? (num_best + 1) : num_best;
+            memmove(&best[j + 1], &best[j], (num_best - 1 - j) * sizeof(uint32_t));
+            best[j] = i;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    /* Display the best records */
+    for (j = 0; j < num_best; j++)
+    {
+        record = &mapped_records[best[j]];
+        showRecordInfo(record->ID, getMappedName(record), record->account, record->average_score);
+    }
+    free(best);
+    /* Return the number of records displayed */
+    return (int32_t)num_best;
 }
 
 /**
- * @brief Displays the list of students.
+ * @brief Resets the list of students without displaying any message.
  *
- * This function displays the list of students that includes student's ID, student's name,
- * student's account and student's average score.
- * It traverses the linked list and calls the showStudentInfo function for each student (node).
+ * This function resets the head, the tail and the number of students of the list, empties the indexes,
+ * the sorted views and the columns and releases every node and every name.
  */
-void showListStudents(void)
+static void resetList(void)
 {
-    Student_t *student = head;
-    while (student != NULL)
+    /* Reset the head, the tail and the number of students of the list */
+    student_list.head = NULL;
+    student_list.tail = NULL;
+    student_list.count = 0;
+    /* Empty the indexes of the list */
+    freeStudentIndex(&id_index);
+    freeStudentIndex(&account_index);
+    freeScoreIndex(&score_index);
+    releaseNameIndex();
+    /* Free the sorted views and the columns, the columns stay enabled */
+    freeSortedView(&score_view);
+    freeSortedView(&name_view);
+    freeSortedView(&position_view);
+    list_order = NULL;
+    freeStudentColumns(&student_columns);
+    /* Release every node of the list and every name */
+    releaseStudentPool();
+    releaseStringPool();
+}
+
+/**
+ * @brief Computes the checksum of a buffer.
+ *
+ * This function mixes every byte of a buffer into a 32-bit FNV-1a hash value.
+ *
+ * @param data The buffer.
+ * @param size The number of bytes of the buffer.
+ * @param hash The hash value to start from.
+ * @return The hash value after mixing the buffer.
+ */
+static uint32_t computeChecksum(const uint8_t *data, size_t size, uint32_t hash)
+{
+    size_t i = 0;       /* Index of each byte of the buffer */
+
+    /* Mix every byte of the buffer into the hash */
+    for (i = 0; i < size; i++)
     {
-        showStudentInfo(student);
-        student = student->next;
+        hash ^= data[i];
+        hash *= 16777619u;
     }
+    /* Return the hash value */
+    return hash;
 } /* EOF */
-
@@ -16,6 +16,7 @@
 #include <stdint.h>  /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
 #include <stdlib.h>  /* For malloc(), free() functions*/
 #include <string.h>  /* For strcpy(), strcmp() functions*/
+#include <time.h>    /* For clock() function */
 
 /*******************************************************************************
  * Header guards
@@ -23,6 +24,17 @@
 #ifndef MANAGE_STUDENTS_H
 #define MANAGE_STUDENTS_H
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define STUDENT_KEY_SIZE    16      /* The size of the ID and the account of a student, including the null terminator */
+#define SNAPSHOT_MAGIC      0x4C445453u     /* The magic number at the start of a snapshot file ("STDL") */
+#define SNAPSHOT_VERSION    1u              /* The version of the snapshot format */
+#define STUDENT_CONFLICT_NONE       0x00u   /* Neither the ID nor the account is already on the list */
+#define STUDENT_CONFLICT_ID         0x01u   /* The ID is already on the list */
+#define STUDENT_CONFLICT_ACCOUNT    0x02u   /* The account is already on the list */
+#define CLASS_STATS_BANDS           10      /* The number of bands of the histogram of average scores, one per point */
+
 /*******************************************************************************
  * Declarations
  ******************************************************************************/
@@ -34,16 +46,165 @@
  * each node of the linked list.
  * It contains the ID, name, account, average score of the student and
  * a pointer to the next student in the list.
+ * The short ID and account are stored inline while the name is stored in the string pool and
+ * referenced by its offset, so a node only takes 56 bytes.
+ * The hash values of the ID and of the account are computed once when the student is created, so the
+ * indexes and the scans compare them before comparing the strings. The name needs no hash value:
+ * equal names share the same offset in the string pool.
  */
 typedef struct Student
 {
-    int8_t ID[30];          /* The ID of the student */
-    int8_t name[100];       /* The name of the student */
-    int8_t account[30];     /* The account of the student */
-    float average_score;    /* The average score of the student */
-    struct Student *next;   /* Pointer to the next student in the list */
+    struct Student *next;               /* Pointer to the next student in the list */
+    float average_score;                /* The average score of the student */
+    uint32_t name_offset;               /* The offset of the name of the student in the string pool */
+    uint32_t id_hash;                   /* The hash value of the ID of the student */
+    uint32_t account_hash;              /* The hash value of the account of the student */
+    uint32_t name_position;             /* The position of the student in the entry of its name in the name index */
+    int8_t ID[STUDENT_KEY_SIZE];        /* The ID of the student */
+    int8_t account[STUDENT_KEY_SIZE];   /* The account of the student */
 } Student_t;
 
+/**
+ * @struct StudentList
+ * @brief This structure describes the linked list of students.
+ *
+ * This structure keeps the head and the tail of the linked list together with the number of
+ * students in the list, so appending a student and querying the size of the list take constant time.
+ */
+typedef struct StudentList
+{
+    Student_t *head;        /* Pointer to the first student of the list */
+    Student_t *tail;        /* Pointer to the last student of the list */
+    int32_t count;          /* The number of students in the list */
+} StudentList_t;
+
+/**
+ * @enum StudentField
+ * @brief This enumeration lists the fields of a student which can be searched.
+ */
+typedef enum StudentField
+{
+    STUDENT_FIELD_ID = 0,       /* The ID of the student */
+    STUDENT_FIELD_NAME,         /* The name of the student */
+    STUDENT_FIELD_ACCOUNT       /* The account of the student */
+} StudentField_t;
+
+/**
+ * @enum NameMatch
+ * @brief This enumeration lists the ways a pattern can match a name.
+ */
+typedef enum NameMatch
+{
+    NAME_MATCH_PREFIX = 0,      /* The name starts with the pattern */
+    NAME_MATCH_SUBSTRING        /* The name contains the pattern */
+} NameMatch_t;
+
+/**
+ * @struct StudentRecord
+ * @brief This structure describes a student to be added by addStudentsBatch.
+ */
+typedef struct StudentRecord
+{
+    const int8_t *ID;           /* The ID of the student */
+    const int8_t *name;         /* The name of the student */
+    const int8_t *account;      /* The account of the student */
+    float average_score;        /* The average score of the student */
+} StudentRecord_t;
+
+/**
+ * @enum OutputFormat
+ * @brief This enumeration lists the formats of the list written by writeListStudents.
+ */
+typedef enum OutputFormat
+{
+    OUTPUT_FORMAT_BLOCK = 0,    /* One line per field between two lines of dashes, like showListStudents */
+    OUTPUT_FORMAT_TABLE,        /* One line per student in aligned columns, after a line of column names */
+    OUTPUT_FORMAT_CSV,          /* One row ID,name,account,score per student, after a header row */
+    OUTPUT_FORMAT_JSON          /* One JSON object per student and per line */
+} OutputFormat_t;
+
+/**
+ * @struct ListOutputResult
+ * @brief This structure represents the result of writing the list.
+ */
+typedef struct ListOutputResult
+{
+    int32_t num_students;       /* The number of students written */
+    uint64_t num_bytes;         /* The number of bytes written */
+    double seconds;             /* The time spent on writing the list, in seconds */
+    double megabytes_per_second;    /* The number of megabytes (10^6 bytes) written per second */
+} ListOutputResult_t;
+
+/**
+ * @struct ClassStatistics
+ * @brief This structure represents the statistics of the average scores of the list.
+ *
+ * Band i of the histogram counts the average scores from i included to i + 1 excluded,
+ * the last band also counts the average scores from CLASS_STATS_BANDS upwards.
+ */
+typedef struct ClassStatistics
+{
+    int32_t num_students;       /* The number of students */
+    double mean;                /* The mean of the average scores */
+    double std_dev;             /* The standard deviation of the average scores */
+    float min_score;            /* The lowest average score */
+    float max_score;            /* The highest average score */
+    uint32_t bands[CLASS_STATS_BANDS];  /* The number of students of each band of average scores */
+} ClassStatistics_t;
+
+/**
+ * @brief Pointer to a function which compares two students.
+ *
+ * The function returns a negative value if the first student has to be placed before the second student,
+ * a positive value if it has to be placed after the second student and 0 if their order does not matter.
+ */
+typedef int32_t (*StudentCompare_t)(const Student_t *first, const Student_t *second);
+
+/**
+ * @struct StudentResultSet
+ * @brief This structure represents the students found by a search, in the order of the list.
+ *
+ * The students belong to the list, they may only be used until a student is added to or deleted from it.
+ * The array is freed by freeStudentResultSet.
+ */
+typedef struct StudentResultSet
+{
+    Student_t **students;       /* The students found */
+    uint32_t count;             /* The number of students found */
+    uint32_t capacity;          /* The number of students the array can hold */
+} StudentResultSet_t;
+
+/**
+ * @struct SnapshotHeader
+ * @brief This structure represents the header of a snapshot file of the list.
+ *
+ * A snapshot file starts with this header, followed by the packed records of the students in list order
+ * and by the buffer of the names which the records refer to by offset.
+ * The checksum is the 32-bit FNV-1a hash of the records and of the names.
+ * Numbers are stored in the byte order of the machine which saved the snapshot.
+ */
+typedef struct SnapshotHeader
+{
+    uint32_t magic;         /* The magic number SNAPSHOT_MAGIC */
+    uint32_t version;       /* The version of the snapshot format */
+    uint32_t count;         /* The number of records */
+    uint32_t names_size;    /* The number of bytes of the buffer of names */
+    uint32_t checksum;      /* The checksum of the records and of the names */
+    uint32_t reserved;      /* Reserved, always 0 */
+} SnapshotHeader_t;
+
+/**
+ * @struct SnapshotRecord
+ * @brief This structure represents the record of a student in a snapshot file.
+ */
+typedef struct SnapshotRecord
+{
+    int8_t ID[STUDENT_KEY_SIZE];        /* The ID of the student */
+    int8_t account[STUDENT_KEY_SIZE];   /* The account of the student */
+    float average_score;                /* The average score of the student */
+    uint32_t name_offset;               /* The offset of the name of the student in the buffer of names */
+} SnapshotRecord_t;
+
 /*******************************************************************************
  * Prototype
  ******************************************************************************/
@@ -57,10 +218,19 @@ typedef struct Student
  */
 int32_t is_List_Exist(void);
 
+/**
+ * @brief Gets the number of students in the list.
+ *
+ * This function returns the number of students which is kept in the list descriptor.
+ *
+ * @return The number of students in the list.
+ */
+int32_t getListSize(void);
+
 /**
  * @brief Checks if the input ID exists.
  *
- * This function checks if the input ID exists.
+ * This function checks if the input ID exists by looking it up in the ID index.
  * It returns 1 if the ID exists, 0 otherwise.
  *
  * @param ID The ID to be checked.
@@ -71,7 +241,8 @@ int32_t is_ID_Exist(int8_t *ID);
 /**
  * @brief Checks if the input name exists.
  *
- * This function checks if the input name exists.
+ * This function checks if the input name exists by looking it up in the name index.
+ * A name which has never been interned into the string pool does not exist.
  * It returns 1 if the name exists, 0 otherwise.
  *
  * @param name The name to be checked.
@@ -82,7 +253,7 @@ int32_t is_Name_Exist(int8_t *name);
 /**
  * @brief Checks if the input account exists.
  *
- * This function checks if the input account exists.
+ * This function checks if the input account exists by looking it up in the account index.
  * It returns 1 if the account exists, 0 otherwise.
  *
  * @param account The account to be checked.
@@ -90,10 +261,37 @@ int32_t is_Name_Exist(int8_t *name);
  */
 int32_t is_Account_Exist(int8_t *account);
 
+/**
+ * @brief Checks if the ID and the account of a new student are already on the list.
+ *
+ * This function checks both fields with one call: the ID index and the account index are looked up,
+ * or the records of a read-only snapshot are scanned once, stopping as soon as every checked field
+ * has been found.
+ * A field is not checked if its pointer is NULL.
+ *
+ * @param ID The ID to be checked, or NULL.
+ * @param account The account to be checked, or NULL.
+ * @return STUDENT_CONFLICT_NONE, or STUDENT_CONFLICT_ID and/or STUDENT_CONFLICT_ACCOUNT combined with '|'.
+ */
+uint32_t checkStudentConflicts(const int8_t *ID, const int8_t *account);
+
+/**
+ * @brief Gets the name of a student.
+ *
+ * This function returns the name of a student from the string pool.
+ * The returned pointer is only valid until the next student is created.
+ *
+ * @param student The pointer to the student.
+ * @return The name of the student.
+ */
+const int8_t *getStudentName(const Student_t *student);
+
 /**
  * @brief Creates a new student information (create new node of linked list).
  *
  * This function creates a new student information.
+ * The node is taken from the slab allocator of students and the name is interned into the string pool.
+ * The ID and the account are truncated to STUDENT_KEY_SIZE - 1 characters.
  * It returns a pointer to the new student (new node).
  *
  * @param ID The ID of the student.
@@ -109,45 +307,180 @@ Student_t *createStudentInfo(int8_t *ID, int8_t *name, int8_t *account, float av
  *
  * This function checks if the head of the list is not NULL.
  * If it is not NULL, it prints a message to the console.
- * It then sets the head of the list to NULL.
+ * It then resets the head, the tail and the number of students of the list and
+ * releases every node of the list at once. A read-only snapshot is closed.
  */
 void clearList(void);
 
 /**
  * @brief Adds a new student to the list (add a new node to linked list).
  *
- * This function adds a new student to the list.
+ * This function adds a new student to the list. If a read-only snapshot is opened, the student is not added
+ * and its node is freed.
  * If the head of the list is NULL, it sets the head to the new student.
- * If the head of the list is not NULL, it traverses the list to find the last student and sets
- * the next pointer of the last student to the new student.
+ * If the head of the list is not NULL, it sets the next pointer of the tail of the list to the
+ * new student. The tail of the list is then moved to the new student.
+ * The student is also inserted into the ID index, the account index, the name index and the score index.
  *
  * @param student The new student to be added to the list.
  */
 void addStudentInfoToList(Student_t *student);
 
+/**
+ * @brief Adds several new students to the list at once.
+ *
+ * This function adds the students of a batch of records, the list must not be a read-only snapshot.
+ * The nodes of the batch are allocated in one contiguous block, or one by one if the memory of the block
+ * cannot be allocated, and the ID index and the account index are presized for the final number of students.
+ * Each record is checked once against the indexes, which already hold the students of the list and the accepted
+ * records of the batch, so duplicates inside the batch are found by the same lookup. A record is rejected if its ID
+ * or its account is empty, not shorter than STUDENT_KEY_SIZE characters or already used.
+ * The accepted students are chained in the order of the records and spliced after the tail of the list.
+ * The score index is rebuilt at once when the batch is at least as large as the list, otherwise the students
+ * are inserted into it one by one.
+ *
+ * @param records The records of the students to be added.
+ * @param num_records The number of records.
+ * @param num_rejected Pointer to a variable which receives the number of rejected records.
+ * @return The number of students added.
+ */
+int32_t addStudentsBatch(const StudentRecord_t *records, int32_t num_records, int32_t *num_rejected);
+
 /**
  * @brief Deletes a student from the list.
  *
- * This function deletes a student from the list.
+ * This function deletes a student from the list, nothing happens if the list is a read-only snapshot.
  * It takes the ID of the student to be deleted as an argument.
+ * The node to be deleted is looked up in the ID index, nothing happens if the ID is not on the list.
  * If the node to be deleted is the first node, it sets the head to the next node and
  * frees the memory of the first node.
- * If the node to be deleted is not the first node, it traverses the list to find the node
- * to delete and the pointer before it.
+ * If the node to be deleted is not the first node, it traverses the list to find the pointer before it
+ * by comparing node addresses only.
  * It then sets the next pointer of the node before the node to be deleted to the next node of the node
- * to be deleted and frees the memory of the node to be deleted.
+ * to be deleted and gives the node to be deleted back to the slab allocator.
+ * The tail, the number of students and the indexes of the list are updated accordingly.
  *
  * @param ID The ID of the student to be deleted.
  */
 void deleteStudentInfo(int8_t *ID);
 
+/**
+ * @brief Deletes several students from the list at once.
+ *
+ * This function deletes the students having the given IDs, nothing happens if the list is a read-only snapshot.
+ * The students to be deleted are looked up in the ID index and put into a temporary hash set, then the list
+ * is traversed once: every student of the set is unlinked, removed from the indexes and given back to
+ * the slab allocator. The traversal stops after the last student of the set.
+ * An ID given several times is only deleted once.
+ *
+ * @param IDs The IDs of the students to be deleted.
+ * @param num_IDs The number of IDs.
+ * @param missing_IDs An array of at least num_IDs pointers which receives the IDs which are not on the list, or NULL.
+ * @param num_missing Pointer to a variable which receives the number of IDs which are not on the list.
+ * @return The number of students deleted.
+ */
+int32_t deleteStudentsBatch(int8_t **IDs, int32_t num_IDs, int8_t **missing_IDs, int32_t *num_missing);
+
+/**
+ * @brief Sorts the linked list by the given comparison function.
+ *
+ * This function sorts the linked list with a stable merge sort, nothing happens if the list is a read-only
+ * snapshot. The students are relinked by their next pointers only, so no data of the students is copied.
+ * A large list is cut into one segment per thread set by setSortThreads, the segments are sorted and then
+ * merged pairwise on separate threads.
+ * The head and the tail of the list are updated when the sort is done.
+ *
+ * @param compare The function which compares two students, it is called from several threads at once.
+ */
+void sortList(StudentCompare_t compare);
+
+/**
+ * @brief Sets the number of threads used to sort the list.
+ *
+ * The default is 1, so the list is sorted on the calling thread.
+ *
+ * @param num_threads The number of threads, it is clamped between 1 and LIST_SORT_MAX_THREADS.
+ */
+void setSortThreads(int32_t num_threads);
+
+/**
+ * @brief Gets the number of threads used to sort the list.
+ *
+ * @return The number of threads used to sort the list.
+ */
+int32_t getSortThreads(void);
+
+/**
+ * @brief Sets the number of threads used to scan the list by findStudentsByName.
+ *
+ * The default is 1, so the list is scanned on the calling thread. With more threads the scan is shared
+ * between the calling thread and a pool of worker threads: with the columnar storage the column of students
+ * gives every thread its part of the list, otherwise an array of the students in the order of the list
+ * is filled by the first scan after the list changed.
+ *
+ * @param num_threads The number of threads, it is clamped between 1 and STUDENT_SCAN_MAX_THREADS.
+ */
+void setSearchThreads(int32_t num_threads);
+
+/**
+ * @brief Gets the number of threads used to scan the list.
+ *
+ * @return The number of threads used to scan the list.
+ */
+int32_t getSearchThreads(void);
+
+/**
+ * @brief Enables or disables the columnar storage of the list.
+ *
+ * When it is enabled, the average scores of the students are also stored in a contiguous column
+ * in the order of the list, so sortByScore and countStudentsByScoreRange read 4 bytes per student
+ * instead of a whole node. Every other function works the same way in both storages.
+ * It is disabled by default.
+ *
+ * @param is_enabled 1 to enable the columnar storage, 0 to disable it.
+ */
+void setColumnarStorage(int32_t is_enabled);
+
+/**
+ * @brief Checks if the columnar storage of the list is enabled.
+ *
+ * @return 1 if the columnar storage is enabled, 0 otherwise.
+ */
+int32_t is_List_Columnar(void);
+
+/**
+ * @brief Enables or disables the concurrent access to the list.
+ *
+ * When it is enabled, the list may be used by several threads at the same time. The functions which only
+ * read the list (is_*_Exist, checkStudentConflicts, the searches, countStudentsByScoreRange,
+ * computeClassStatistics, showTopStudentsByScore, saveListToFile, ...) run in parallel with each other,
+ * while the functions which change the list (createStudentInfo, the additions, the deletions, the sorts,
+ * clearList, loadListFromFile, openListSnapshot, ...) and writeListStudents, whose buffer is shared,
+ * run alone. getStudentName takes no lock, its result may only be used while no function changes the list,
+ * and the compare function given to sortList must not call any other function of the list.
+ * It is disabled by default. It must be called while no other thread uses the list.
+ *
+ * @param is_enabled 1 to enable the concurrent access, 0 to disable it.
+ */
+void setConcurrentAccess(int32_t is_enabled);
+
+/**
+ * @brief Checks if the concurrent access to the list is enabled.
+ *
+ * @return 1 if the concurrent access is enabled, 0 otherwise.
+ */
+int32_t is_List_Concurrent(void);
+
 /**
  * @brief Sorts the linked list by student's average score.
  *
- * This function sorts the linked list by student's average score in descending order.
- * It uses the bubble sort algorithm to compare the average scores of each student.
- * If the average score of the current student is less than the average score of the next student,
- * it swaps the average scores of the two students.
+ * This function sorts the linked list by student's average score in descending order, nothing happens
+ * if the list is a read-only snapshot.
+ * The students are sorted in linear time by a radix sort of their encoded average scores,
+ * students having the same average score keep their order. With the columnar storage the encoded
+ * scores are read from the score column.
+ * The order is cached until a student is added or deleted, so sorting an unchanged list again does not
+ * compare any student when no two students have the same average score, otherwise the list is sorted again.
  */
 void sortByScore(void);
 
@@ -155,9 +488,10 @@ void sortByScore(void);
  * @brief Sorts the linked list by student's name.
  *
  * This function sorts the list of students by their name in ascending order.
- * It uses the bubble sort algorithm to compare the names of each student.
- * If the name of the current student is greater than the name of the next student,
- * it swaps the names of the two students.
+ * It sorts the list like sortList with a comparison of the names of two students,
+ * students having the same name keep their order.
+ * The order is cached until a student is added or deleted, so sorting an unchanged list again does not
+ * compare any student when no two students have the same name, otherwise the list is sorted again.
  */
 void sortByName(void);
 
@@ -165,8 +499,8 @@ void sortByName(void);
  * @brief Searching for an student's information by their ID.
  *
  * This function searches for a student's information by their ID.
- * If the ID of the current student is equal to the input ID,
- * it displays the information of the student.
+ * The student is looked up in the ID index,
+ * it displays the information of the student if found.
  *
  * @param ID The ID of the student to be searched.
  */
@@ -176,32 +510,212 @@ void searchInfoByID(int8_t *ID);
  * @brief Searching for an student's information by their name.
  *
  * This function searches for an student's information by their name.
- * If the name of the current student is equal to the input name,
- * it displays the information of the student.
+ * The students having the input name are found in the name index and displayed in the order in which
+ * they were added to the list.
  *
  * @param name The name of the student to be searched.
  */
 void searchInfoByName(int8_t *name);
 
+/**
+ * @brief Searching for the students whose name starts with or contains a pattern.
+ *
+ * This function finds the matching names in the trigram index of the names, so only the names sharing
+ * the rarest trigram of the pattern are compared. The students of each matching name are displayed in the
+ * order in which they were added to the list.
+ * If a read-only snapshot is opened, its records are scanned instead.
+ *
+ * @param pattern The pattern to be found.
+ * @param match NAME_MATCH_PREFIX or NAME_MATCH_SUBSTRING.
+ * @return The number of students displayed.
+ */
+int32_t searchInfoByNamePattern(int8_t *pattern, NameMatch_t match);
+
 /**
  * @brief Searching for an student's information by their account.
  *
  * This function searches for an student's information by their account.
- * If the account of the current student is equal to the input account,
- * it displays the information of the student.
+ * The accounts are unique, so the student is looked up in the account index and displayed if found.
+ * If a read-only snapshot is opened, its matching records are scanned instead.
  *
  * @param account The account of the student to be searched.
  */
 void searchInfoByAcc(int8_t *account);
 
+/**
+ * @brief Finds the students having a name.
+ *
+ * This function scans the list and keeps the students having the name in a result set, in the order of
+ * the list. The name is looked up once in the string pool, then only the offsets of the names are compared,
+ * and nothing is scanned if no student has the name. A list of at least two parts of STUDENT_SCAN_MIN_PART
+ * students is cut into one part per thread set by setSearchThreads, the parts are scanned at the same time
+ * and their results are appended in the order of the parts. The records of a read-only snapshot are not students of the list,
+ * nothing is found while one is opened.
+ *
+ * @param name The name to be found.
+ * @param result Pointer to a result set which receives the students found, freed by freeStudentResultSet.
+ * @return The number of students found, -1 if the memory of the result set cannot be allocated.
+ */
+int32_t findStudentsByName(const int8_t *name, StudentResultSet_t *result);
+
+/**
+ * @brief Finds the students having an account.
+ *
+ * This function looks the account up in the account index. The accounts are unique, so the result set
+ * receives at most one student. Nothing is found while a read-only snapshot is opened.
+ *
+ * @param account The account to be found.
+ * @param result Pointer to a result set which receives the students found, freed by freeStudentResultSet.
+ * @return The number of students found, -1 if the memory of the result set cannot be allocated.
+ */
+int32_t findStudentsByAccount(const int8_t *account, StudentResultSet_t *result);
+
+/**
+ * @brief Frees the students of a result set.
+ *
+ * @param result The result set, it is empty afterwards.
+ */
+void freeStudentResultSet(StudentResultSet_t *result);
+
+/**
+ * @brief Searching for the students whose average score is in a range.
+ *
+ * This function displays the students whose average score is between min_score and max_score,
+ * from the highest to the lowest average score. The students are found in the score index,
+ * so only O(log n + k) students are visited for k matching students.
+ *
+ * @param min_score The lowest average score of the range.
+ * @param max_score The highest average score of the range.
+ * @return The number of students displayed.
+ */
+int32_t searchInfoByScoreRange(float min_score, float max_score);
+
+/**
+ * @brief Counts the students whose average score is in a range.
+ *
+ * This function counts the students whose average score is between min_score and max_score without
+ * displaying them, from the score column when the columnar storage is enabled, otherwise from
+ * the score index.
+ *
+ * @param min_score The lowest average score of the range.
+ * @param max_score The highest average score of the range.
+ * @return The number of students whose average score is in the range.
+ */
+int32_t countStudentsByScoreRange(float min_score, float max_score);
+
+/**
+ * @brief Computes the statistics of the average scores of the list.
+ *
+ * This function computes the mean, the lowest and highest average scores, the standard deviation and
+ * the histogram of the average scores in one vectorized pass. The score column is read when the columnar
+ * storage is enabled, otherwise the average scores are gathered from the list, or from the records of
+ * a read-only snapshot, into a small buffer which is processed each time it is full.
+ *
+ * @param statistics Pointer to a structure which receives the statistics, every field is 0 for an empty list.
+ * @return The number of students.
+ */
+int32_t computeClassStatistics(ClassStatistics_t *statistics);
+
+/**
+ * @brief Displays the students having the highest average scores.
+ *
+ * This function displays the first k students of the score index, from the highest average score.
+ * Students having the same average score are displayed by ascending ID.
+ *
+ * @param k The number of students to be displayed.
+ * @return The number of students displayed, less than k if the list has fewer students.
+ */
+int32_t showTopStudentsByScore(int32_t k);
+
 /**
  * @brief Displays the list of students.
  *
  * This function displays the list of students that includes student's ID, student's name,
  * student's account and student's average score.
- * It traverses the linked list and calls the showStudentInfo function for each student (node).
+ * It writes the list to the standard output with writeListStudents in the block layout of showStudentInfo.
  */
 void showListStudents(void);
 
+/**
+ * @brief Writes the list of students to a stream in a format.
+ *
+ * This function traverses the list, or the records of the read-only snapshot, and formats every student
+ * into a buffer of 1 MiB which is written to the file descriptor of the stream with one call each time
+ * it is full. The stream is flushed first, so the list follows what was printed to it before.
+ *
+ * @param stream The stream which receives the list.
+ * @param format The format of the list.
+ * @param result Pointer to a structure which receives the number of students and bytes written and the throughput.
+ * @return 1 if the whole list is written, 0 if a write failed.
+ */
+int32_t writeListStudents(FILE *stream, OutputFormat_t format, ListOutputResult_t *result);
+
+/**
+ * @brief Saves the list of students to a snapshot file.
+ *
+ * This function packs the records of the students into one buffer and writes the header, the records
+ * and the buffer of names with one call each. The file is not opened, so it is not truncated,
+ * if the memory of the records cannot be allocated.
+ *
+ * @param path The path of the snapshot file.
+ * @return 1 if the snapshot is saved, 0 otherwise.
+ */
+int32_t saveListToFile(const char *path);
+
+/**
+ * @brief Loads the list of students from a snapshot file.
+ *
+ * This function reads the whole snapshot file with one call, verifies its header and its checksum and
+ * then replaces the list of students by the records of the snapshot.
+ * The current list is kept if the snapshot is not valid. A record whose ID or account is empty
+ * or is already used by a previous record of the snapshot is skipped and counted in num_skipped.
+ *
+ * @param path The path of the snapshot file.
+ * @param num_skipped Pointer to a variable which receives the number of skipped records.
+ * @return 1 if the snapshot is loaded, 0 otherwise.
+ */
+int32_t loadListFromFile(const char *path, int32_t *num_skipped);
+
+/**
+ * @brief Opens a snapshot file as a read-only list of students.
+ *
+ * This function maps a snapshot file into memory without copying its records into nodes.
+ * While the snapshot is opened, is_List_Exist, getListSize, the is_*_Exist functions, the searchInfoBy*
+ * functions, showListStudents and saveListToFile work directly on the mapped records, and the list cannot
+ * be modified. The mapped pages are shared by every process which opens the same snapshot.
+ * Only the header and the size of the file are verified, the checksum is not, so opening is instant.
+ * The current list is released when the snapshot is opened.
+ *
+ * @param path The path of the snapshot file.
+ * @return 1 if the snapshot is opened, 0 otherwise.
+ */
+int32_t openListSnapshot(const char *path);
+
+/**
+ * @brief Closes the read-only snapshot.
+ *
+ * This function unmaps the snapshot opened by openListSnapshot, the list becomes empty.
+ * Nothing happens if no snapshot is opened.
+ */
+void closeListSnapshot(void);
+
+/**
+ * @brief Checks if the list is a read-only snapshot.
+ *
+ * This function checks if a snapshot is opened by openListSnapshot.
+ * It returns 1 if the list is read-only, 0 otherwise.
+ *
+ * @return 1 if the list is read-only, 0 otherwise.
+ */
+int32_t is_List_ReadOnly(void);
+
+/**
+ * @brief Displays the memory usage of the list of students.
+ *
+ * This function displays the number of bytes allocated for the nodes, the string pool and the indexes
+ * of the list, and the number of bytes per student.
+ */
+void showMemoryUsage(void);
+
 #endif /* MANAGE_STUDENTS_H */
 
@@ -0,0 +1,775 @@
+/**
+ * @file name_index.c
+ * @brief This file contains the function definitions for the name index of students.
+ *
+ * The file includes the function definitions of an index over the distinct names of the string pool.
+ * The entries of the names are found by their offset in an open-addressing hash table. Every trigram
+ * (three consecutive characters) of a name is added to a second hash table, which maps the trigram to
+ * the list of the entries containing it. The trigrams of the start of a name begin with a start mark,
+ * so a prefix is matched like a substring of the name preceded by the start mark.
+ * Entries and trigrams are never moved one by one: an entry left without students stays where it is
+ * until half of the entries are in this state, then the whole index is compacted at once.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "name_index.h"         /* Include header file of this function file */
+#include "string_pool.h"        /* Include header file for the getPooledString function */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define NAME_INDEX_MIN_SLOTS    256u        /* The capacity of a newly allocated hash table */
+#define NAME_INDEX_START_MARK   0x01u       /* The character which precedes every name in its trigrams */
+#define NAME_INDEX_GRAM_MASK    0xFFFFFFu   /* The mask keeping the last three characters of a trigram */
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct NameGram
+ * @brief This structure represents a trigram of the name index.
+ *
+ * This structure holds the positions of the entries whose name contains the trigram, in ascending order.
+ */
+typedef struct NameGram
+{
+    uint32_t gram;              /* The three characters of the trigram, packed in one number */
+    uint32_t count;             /* The number of entries containing the trigram */
+    uint32_t capacity;          /* The number of entries which the array can hold */
+    uint32_t *entries;          /* The positions of the entries containing the trigram */
+} NameGram_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static NameEntry_t *name_entries = NULL;    /* The entries of the distinct names */
+static uint32_t num_name_entries = 0;       /* The number of entries */
+static uint32_t name_entry_capacity = 0;    /* The number of entries which the array can hold */
+static uint32_t num_empty_entries = 0;      /* The number of entries without students, freed by the next compaction */
+static uint32_t *entry_slots = NULL;        /* The hash table of the entries, each slot stores the position of an entry plus one, 0 when empty */
+static uint32_t entry_slot_capacity = 0;    /* The number of slots of the hash table of the entries, always a power of two */
+static NameGram_t *name_grams = NULL;       /* The trigrams of the names */
+static uint32_t num_name_grams = 0;         /* The number of trigrams */
+static uint32_t name_gram_capacity = 0;     /* The number of trigrams which the array can hold */
+static uint32_t *gram_slots = NULL;         /* The hash table of the trigrams, each slot stores the position of a trigram plus one, 0 when empty */
+static uint32_t gram_slot_capacity = 0;     /* The number of slots of the hash table of the trigrams, always a power of two */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Mixes the bits of a key into a hash value.
+ *
+ * @param key The key to be hashed.
+ * @return The hash value of the key.
+ */
+static uint32_t hashNameKey(uint32_t key);
+
+/**
+ * @brief Finds the slot of a name in the hash table of the entries.
+ *
+ * @param name_offset The offset of the name in the string pool.
+ * @return The position of the slot holding the entry of the name, or of the empty slot where it belongs.
+ */
+static uint32_t findEntrySlot(uint32_t name_offset);
+
+/**
+ * @brief Finds the slot of a trigram in the hash table of the trigrams.
+ *
+ * @param gram The trigram to be found.
+ * @return The position of the slot holding the trigram, or of the empty slot where it belongs.
+ */
+static uint32_t findGramSlot(uint32_t gram);
+
+/**
+ * @brief Doubles the capacity of the hash table of the entries.
+ */
+static void growEntrySlots(void);
+
+/**
+ * @brief Doubles the capacity of the hash table of the trigrams.
+ */
+static void growGramSlots(void);
+
+/**
+ * @brief Adds an entry to the list of a trigram.
+ *
+ * @param gram The trigram.
+ * @param entry The position of the entry whose name contains the trigram.
+ */
+static void addGramEntry(uint32_t gram, uint32_t entry);
+
+/**
+ * @brief Finds a trigram.
+ *
+ * @param gram The trigram to be found.
+ * @return A pointer to the trigram, NULL if no name contains it.
+ */
+static const NameGram_t *findGram(uint32_t gram);
+
+/**
+ * @brief Moves the students of an entry over the positions of the removed students.
+ *
+ * @param entry The entry to be compacted.
+ */
+static void compactNameEntry(NameEntry_t *entry);
+
+/**
+ * @brief Frees the entries without students and the trigrams which only they contain.
+ */
+static void compactNameIndex(void);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Adds a student to the name index.
+ *
+ * This function appends the student to the entry of its name. If the name has no entry yet, the entry
+ * is created and every trigram of the name is added to the trigram index.
+ *
+ * @param student The student to be added.
+ */
+void addStudentToNameIndex(Student_t *student)
+{
+    uint32_t pos = 0;                   /* The position of the slot of the name */
+    uint32_t id = 0;                    /* The position of the entry of the name */
+    NameEntry_t *entry = NULL;          /* The entry of the name */
+    const int8_t *name = NULL;          /* Temporary pointer to traverse the name */
+    uint32_t gram = NAME_INDEX_START_MARK;  /* The last three characters of the name */
+    uint32_t length = 1;                /* The number of characters read, including the start mark */
+
+    /* Keep the hash table of the entries at most half full */
+    if ((num_name_entries + 1) * 2 > entry_slot_capacity)
+    {
+        growEntrySlots();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    pos = findEntrySlot(student->name_offset);
+    /* If the name has no entry yet, create it and index its trigrams */
+    if (entry_slots[pos] == 0)
+    {
+        if (num_name_entries == name_entry_capacity)
+        {
+            name_entry_capacity = (name_entry_capacity == 0) ? NAME_INDEX_MIN_SLOTS : (name_entry_capacity * 2);
+            name_entries = (NameEntry_t *)realloc(name_entries, name_entry_capacity * sizeof(NameEntry_t));
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        id = num_name_entries;
+        num_name_entries++;
+        entry_slots[pos] = id + 1;
+        name_entries[id].name_offset = student->name_offset;
+        name_entries[id].count = 0;
+        name_entries[id].length = 0;
+        name_entries[id].capacity = 0;
+        name_entries[id].students = NULL;
+
+        for (name = getPooledString(student->name_offset); *name != '\0'; name++)
+        {
+            gram = ((gram << 8) | (uint8_t)*name) & NAME_INDEX_GRAM_MASK;
+            length++;
+            if (length >= 3)
+            {
+                addGramEntry(gram, id);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    else
+    {
+        id = entry_slots[pos] - 1;
+        /* An entry without students is used again until the next compaction */
+        if (name_entries[id].count == 0)
+        {
+            num_empty_entries--;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    /* Append the student to the entry of its name */
+    entry = &name_entries[id];
+    if (entry->length == entry->capacity)
+    {
+        entry->capacity = (entry->capacity == 0) ? 1 : (entry->capacity * 2);
+        entry->students = (Student_t **)realloc(entry->students, entry->capacity * sizeof(Student_t *));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    entry->students[entry->length] = student;
+    student->name_position = entry->length;
+    entry->length++;
+    entry->count++;
+}
+
+/**
+ * @brief Removes a student from the name index.
+ *
+ * This function replaces the student with NULL at its position in the entry of its name, so the order of
+ * the other students is kept without moving them. The entry is compacted once half of its positions are NULL.
+ * An entry left without students frees its array, and the index is compacted once half of the entries
+ * have no students.
+ * Nothing happens if the student is not in the index.
+ *
+ * @param student The student to be removed.
+ */
+void removeStudentFromNameIndex(Student_t *student)
+{
+    NameEntry_t *entry = (NameEntry_t *)findNameEntry(student->name_offset);   /* The entry of the name */
+    uint32_t i = student->name_position;   /* Position of the student in the entry */
+
+    if ((entry != NULL) && (i < entry->length) && (entry->students[i] == student))
+    {
+        entry->students[i] = NULL;
+        entry->count--;
+        if (entry->count == 0)
+        {
+            free(entry->students);
+            entry->students = NULL;
+            entry->length = 0;
+            entry->capacity = 0;
+            num_empty_entries++;
+            if (num_empty_entries * 2 > num_name_entries)
+            {
+                compactNameIndex();
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else if ((entry->length - entry->count) * 2 > entry->length)
+        {
+            compactNameEntry(entry);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Finds the entry of a name.
+ *
+ * @param name_offset The offset of the name in the string pool.
+ * @return A pointer to the entry of the name, NULL if the name has no entry. The entry may have no students.
+ */
+const NameEntry_t *findNameEntry(uint32_t name_offset)
+{
+    const NameEntry_t *entry = NULL;    /* Initialize entry to NULL */
+    uint32_t pos = 0;                   /* The position of the slot of the name */
+
+    /* If the hash table is allocated, look the name up */
+    if ((entry_slots != NULL) && (name_offset != STRING_POOL_NONE))
+    {
+        pos = findEntrySlot(name_offset);
+        if (entry_slots[pos] != 0)
+        {
+            entry = &name_entries[entry_slots[pos] - 1];
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the entry of the name */
+    return entry;
+}
+
+/**
+ * @brief Finds the names matching a pattern.
+ *
+ * This function takes the trigram of the pattern having the fewest names and checks only these names.
+ * A prefix is matched with the trigrams of the start of the names. A pattern shorter than a trigram
+ * is checked against every distinct name. Only the names of at least one student are returned.
+ *
+ * @param pattern The pattern to be found.
+ * @param match NAME_MATCH_PREFIX or NAME_MATCH_SUBSTRING.
+ * @param num_entries Pointer to a variable which receives the number of matching names.
+ * @return An array of pointers to the matching entries, which must be freed with free().
+ */
+const NameEntry_t **findNameEntries(const int8_t *pattern, NameMatch_t match, uint32_t *num_entries)
+{
+    const NameEntry_t **matches = NULL;     /* The matching entries */
+    const NameGram_t *best = NULL;          /* The trigram of the pattern having the fewest entries */
+    const NameGram_t *candidate = NULL;     /* The trigram of the pattern at the current position */
+    const int8_t *name = NULL;              /* The name of each candidate entry */
+    size_t length = strlen(pattern);        /* The number of characters of the pattern */
+    uint32_t gram = (match == NAME_MATCH_PREFIX) ? NAME_INDEX_START_MARK : 0;   /* The last three characters of the pattern */
+    uint32_t num_read = (match == NAME_MATCH_PREFIX) ? 1 : 0;  /* The number of characters read */
+    uint32_t num_candidates = num_name_entries;    /* The number of entries to be checked */
+    uint32_t id = 0;                        /* The position of each candidate entry */
+    uint32_t i = 0;                         /* Initialize temporary variable */
+    int32_t is_missing = 0;                 /* 1 if a trigram of the pattern is in no name */
+    int32_t is_match = 0;                   /* 1 if the candidate entry matches the pattern */
+
+    /* Find the trigram of the pattern having the fewest entries */
+    for (i = 0; i < length; i++)
+    {
+        gram = ((gram << 8) | (uint8_t)pattern[i]) & NAME_INDEX_GRAM_MASK;
+        num_read++;
+        if (num_read >= 3)
+        {
+            candidate = findGram(gram);
+            is_missing = is_missing || (candidate == NULL);
+            best = ((candidate != NULL) && ((best == NULL) || (candidate->count < best->count))) ? candidate : best;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    if (is_missing)
+    {
+        num_candidates = 0;
+    }
+    else if (best != NULL)
+    {
+        num_candidates = best->count;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Check every candidate entry */
+    *num_entries = 0;
+    matches = (const NameEntry_t **)malloc((num_candidates > 0) ? (num_candidates * sizeof(NameEntry_t *)) : 1);
+    for (i = 0; i < num_candidates; i++)
+    {
+        id = (best != NULL) ? best->entries[i] : i;
+        name = getPooledString(name_entries[id].name_offset);
+        if (match == NAME_MATCH_PREFIX)
+        {
+            is_match = (strncmp((const char *)name, (const char *)pattern, length) == 0) ? 1 : 0;
+        }
+        else
+        {
+            is_match = (strstr((const char *)name, (const char *)pattern) != NULL) ? 1 : 0;
+        }
+        if (is_match && (name_entries[id].count > 0))
+        {
+            matches[*num_entries] = &name_entries[id];
+            (*num_entries)++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    /* Return the matching entries */
+    return matches;
+}
+
+/**
+ * @brief Gets the number of bytes allocated by the name index.
+ *
+ * @return The number of bytes of the entries, of the trigram index and of their hash tables.
+ */
+size_t getNameIndexBytes(void)
+{
+    size_t bytes = 0;       /* Initialize bytes to 0 */
+    uint32_t i = 0;         /* Initialize temporary variable */
+
+    bytes += (size_t)name_entry_capacity * sizeof(NameEntry_t) + (size_t)entry_slot_capacity * sizeof(uint32_t);
+    bytes += (size_t)name_gram_capacity * sizeof(NameGram_t) + (size_t)gram_slot_capacity * sizeof(uint32_t);
+    for (i = 0; i < num_name_entries; i++)
+    {
+        bytes += (size_t)name_entries[i].capacity * sizeof(Student_t *);
+    }
+    for (i = 0; i < num_name_grams; i++)
+    {
+        bytes += (size_t)name_grams[i].capacity * sizeof(uint32_t);
+    }
+    /* Return the number of bytes */
+    return bytes;
+}
+
+/**
+ * @brief Releases the name index.
+ *
+ * This function frees every entry, every trigram and their hash tables.
+ */
+void releaseNameIndex(void)
+{
+    uint32_t i = 0;         /* Initialize temporary variable */
+
+    for (i = 0; i < num_name_entries; i++)
+    {
+        free(name_entries[i].students);
+    }
+    for (i = 0; i < num_name_grams; i++)
+    {
+        free(name_grams[i].entries);
+    }
+    free(name_entries);
+    free(entry_slots);
+    free(name_grams);
+    free(gram_slots);
+    name_entries = NULL;
+    num_name_entries = 0;
+    name_entry_capacity = 0;
+    num_empty_entries = 0;
+    entry_slots = NULL;
+    entry_slot_capacity = 0;
+    name_grams = NULL;
+    num_name_grams = 0;
+    name_gram_capacity = 0;
+    gram_slots = NULL;
+    gram_slot_capacity = 0;
+}
+
+/**
+ * @brief Mixes the bits of a key into a hash value.
+ *
+ * @param key The key to be hashed.
+ * @return The hash value of the key.
+ */
+static uint32_t hashNameKey(uint32_t key)
+{
+    key *= 2654435761u;
+    key ^= key >> 16;
+    /* Return the hash value */
+    return key;
+}
+
+/**
+ * @brief Finds the slot of a name in the hash table of the entries.
+ *
+ * @param name_offset The offset of the name in the string pool.
+ * @return The position of the slot holding the entry of the name, or of the empty slot where it belongs.
+ */
+static uint32_t findEntrySlot(uint32_t name_offset)
+{
+    uint32_t mask = entry_slot_capacity - 1;                /* The mask to wrap the positions around */
+    uint32_t pos = hashNameKey(name_offset) & mask;         /* The position of the probed slot */
+
+    /* Probe the next slot until the name or an empty slot is found */
+    while ((entry_slots[pos] != 0) && (name_entries[entry_slots[pos] - 1].name_offset != name_offset))
+    {
+        pos = (pos + 1) & mask;
+    }
+    /* Return the position of the slot */
+    return pos;
+}
+
+/**
+ * @brief Finds the slot of a trigram in the hash table of the trigrams.
+ *
+ * @param gram The trigram to be found.
+ * @return The position of the slot holding the trigram, or of the empty slot where it belongs.
+ */
+static uint32_t findGramSlot(uint32_t gram)
+{
+    uint32_t mask = gram_slot_capacity - 1;                 /* The mask to wrap the positions around */
+    uint32_t pos = hashNameKey(gram) & mask;                /* The position of the probed slot */
+
+    /* Probe the next slot until the trigram or an empty slot is found */
+    while ((gram_slots[pos] != 0) && (name_grams[gram_slots[pos] - 1].gram != gram))
+    {
+        pos = (pos + 1) & mask;
+    }
+    /* Return the position of the slot */
+    return pos;
+}
+
+/**
+ * @brief Doubles the capacity of the hash table of the entries.
+ *
+ * This function allocates a new hash table and inserts the position of every entry into it.
+ */
+static void growEntrySlots(void)
+{
+    uint32_t i = 0;         /* Initialize temporary variable */
+
+    free(entry_slots);
+    entry_slot_capacity = (entry_slot_capacity == 0) ? NAME_INDEX_MIN_SLOTS : (entry_slot_capacity * 2);
+    entry_slots = (uint32_t *)calloc(entry_slot_capacity, sizeof(uint32_t));
+    for (i = 0; i < num_name_entries; i++)
+    {
+        entry_slots[findEntrySlot(name_entries[i].name_offset)] = i + 1;
+    }
+}
+
+/**
+ * @brief Doubles the capacity of the hash table of the trigrams.
+ *
+ * This function allocates a new hash table and inserts the position of every trigram into it.
+ */
+static void growGramSlots(void)
+{
+    uint32_t i = 0;         /* Initialize temporary variable */
+
+    free(gram_slots);
+    gram_slot_capacity = (gram_slot_capacity == 0) ? NAME_INDEX_MIN_SLOTS : (gram_slot_capacity * 2);
+    gram_slots = (uint32_t *)calloc(gram_slot_capacity, sizeof(uint32_t));
+    for (i = 0; i < num_name_grams; i++)
+    {
+        gram_slots[findGramSlot(name_grams[i].gram)] = i + 1;
+    }
+}
+
+/**
+ * @brief Adds an entry to the list of a trigram.
+ *
+ * The trigram is created if no name contains it yet. The entries of a name are added after the entries
+ * of every older name, so the list stays in ascending order and a trigram which appears twice in the same
+ * name is only added once.
+ *
+ * @param gram The trigram.
+ * @param entry The position of the entry whose name contains the trigram.
+ */
+static void addGramEntry(uint32_t gram, uint32_t entry)
+{
+    uint32_t pos = 0;               /* The position of the slot of the trigram */
+    NameGram_t *name_gram = NULL;   /* The trigram */
+
+    /* Keep the hash table of the trigrams at most half full */
+    if ((num_name_grams + 1) * 2 > gram_slot_capacity)
+    {
+        growGramSlots();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    pos = findGramSlot(gram);
+    /* If no name contains the trigram yet, create it */
+    if (gram_slots[pos] == 0)
+    {
+        if (num_name_grams == name_gram_capacity)
+        {
+            name_gram_capacity = (name_gram_capacity == 0) ? NAME_INDEX_MIN_SLOTS : (name_gram_capacity * 2);
+            name_grams = (NameGram_t *)realloc(name_grams, name_gram_capacity * sizeof(NameGram_t));
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        name_grams[num_name_grams].gram = gram;
+        name_grams[num_name_grams].count = 0;
+        name_grams[num_name_grams].capacity = 0;
+        name_grams[num_name_grams].entries = NULL;
+        num_name_grams++;
+        gram_slots[pos] = num_name_grams;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Append the entry unless the name already contains the trigram */
+    name_gram = &name_grams[gram_slots[pos] - 1];
+    if ((name_gram->count == 0) || (name_gram->entries[name_gram->count - 1] != entry))
+    {
+        if (name_gram->count == name_gram->capacity)
+        {
+            name_gram->capacity = (name_gram->capacity == 0) ? 4 : (name_gram->capacity * 2);
+            name_gram->entries = (uint32_t *)realloc(name_gram->entries, name_gram->capacity * sizeof(uint32_t));
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        name_gram->entries[name_gram->count] = entry;
+        name_gram->count++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Finds a trigram.
+ *
+ * @param gram The trigram to be found.
+ * @return A pointer to the trigram, NULL if no name contains it.
+ */
+static const NameGram_t *findGram(uint32_t gram)
+{
+    const NameGram_t *name_gram = NULL;     /* Initialize name_gram to NULL */
+    uint32_t pos = 0;                       /* The position of the slot of the trigram */
+
+    /* If the hash table is allocated, look the trigram up */
+    if (gram_slots != NULL)
+    {
+        pos = findGramSlot(gram);
+        if (gram_slots[pos] != 0)
+        {
+            name_gram = &name_grams[gram_slots[pos] - 1];
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the trigram */
+    return name_gram;
+}
+
+/**
+ * @brief Moves the students of an entry over the positions of the removed students.
+ *
+ * This function keeps the order of the students and updates their name_position. The array is shrunk
+ * to the number of students when it is at least four times larger.
+ *
+ * @param entry The entry to be compacted.
+ */
+static void compactNameEntry(NameEntry_t *entry)
+{
+    uint32_t i = 0;                     /* Position of each student before the compaction */
+    uint32_t length = 0;                /* The number of students moved */
+
+    for (i = 0; i < entry->length; i++)
+    {
+        if (entry->students[i] != NULL)
+        {
+            entry->students[length] = entry->students[i];
+            entry->students[length]->name_position = length;
+            length++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    entry->length = length;
+
+    if (entry->count * 4 <= entry->capacity)
+    {
+        entry->capacity = entry->count;
+        entry->students = (Student_t **)realloc(entry->students, entry->capacity * sizeof(Student_t *));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Frees the entries without students and the trigrams which only they contain.
+ *
+ * This function moves the remaining entries to the front of the array in the same order, so their new
+ * positions keep the lists of the trigrams in ascending order. Each list is rewritten with the new positions,
+ * a trigram whose list is left empty is freed, and both hash tables are filled again.
+ * Nothing is changed if the memory of the new positions cannot be allocated.
+ */
+static void compactNameIndex(void)
+{
+    uint32_t *new_ids = (uint32_t *)malloc((num_name_entries > 0) ? (num_name_entries * sizeof(uint32_t)) : 1);   /* The new position of each entry plus one, 0 when it is freed */
+    NameGram_t *name_gram = NULL;       /* Each trigram */
+    uint32_t num_entries = 0;           /* The number of entries kept */
+    uint32_t num_grams = 0;             /* The number of trigrams kept */
+    uint32_t count = 0;                 /* The number of entries kept in the list of a trigram */
+    uint32_t i = 0;                     /* Initialize temporary variable */
+    uint32_t j = 0;                     /* Initialize temporary variable */
+
+    if (new_ids != NULL)
+    {
+        /* Move the entries having students to the front */
+        for (i = 0; i < num_name_entries; i++)
+        {
+            if (name_entries[i].count > 0)
+            {
+                name_entries[num_entries] = name_entries[i];
+                num_entries++;
+                new_ids[i] = num_entries;
+            }
+            else
+            {
+                new_ids[i] = 0;
+            }
+        }
+        num_name_entries = num_entries;
+        num_empty_entries = 0;
+
+        /* Rewrite the list of each trigram and free the trigrams left without entries */
+        for (i = 0; i < num_name_grams; i++)
+        {
+            name_gram = &name_grams[i];
+            count = 0;
+            for (j = 0; j < name_gram->count; j++)
+            {
+                if (new_ids[name_gram->entries[j]] != 0)
+                {
+                    name_gram->entries[count] = new_ids[name_gram->entries[j]] - 1;
+                    count++;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            name_gram->count = count;
+
+            if (count > 0)
+            {
+                name_grams[num_grams] = *name_gram;
+                num_grams++;
+            }
+            else
+            {
+                free(name_gram->entries);
+            }
+        }
+        num_name_grams = num_grams;
+        free(new_ids);
+
+        /* Fill both hash tables again */
+        memset(entry_slots, 0, entry_slot_capacity * sizeof(uint32_t));
+        for (i = 0; i < num_name_entries; i++)
+        {
+            entry_slots[findEntrySlot(name_entries[i].name_offset)] = i + 1;
+        }
+        if (gram_slots != NULL)
+        {
+            memset(gram_slots, 0, gram_slot_capacity * sizeof(uint32_t));
+            for (i = 0; i < num_name_grams; i++)
+            {
+                gram_slots[findGramSlot(name_grams[i].gram)] = i + 1;
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+} /* EOF */
@@ -0,0 +1,109 @@
+/**
+ * @file name_index.h
+ * @brief This file contains the function prototypes and data structures for the name index of students.
+ *
+ * This file contains the function prototypes and data structures of an index over the distinct names of
+ * the string pool. Each distinct name keeps the list of the students having it, and a trigram index maps
+ * every sequence of three characters to the names containing it, so the names starting with a prefix or
+ * containing a substring are found without reading every name.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For malloc(), realloc(), calloc(), free() functions */
+#include <string.h>             /* For strlen(), strncmp(), strstr(), memset() functions */
+#include "manage_students.h"    /* Include header file for the Student_t structure and the NameMatch_t enumeration */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct NameEntry
+ * @brief This structure represents a distinct name of the name index.
+ *
+ * This structure holds the students having the same name, in the order in which they were added.
+ * A removed student leaves NULL at its position, the array is compacted once half of it is NULL.
+ * An entry without students is freed when the index is compacted, until then it is found but skipped.
+ */
+typedef struct NameEntry
+{
+    uint32_t name_offset;       /* The offset of the name in the string pool */
+    uint32_t count;             /* The number of students having the name */
+    uint32_t length;            /* The number of positions used in the array, including the NULL ones */
+    uint32_t capacity;          /* The number of students which the array can hold */
+    Student_t **students;       /* The students having the name, NULL at the positions of removed students */
+} NameEntry_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Adds a student to the name index.
+ *
+ * This function appends the student to the entry of its name. If the name has no entry yet, the entry
+ * is created and every trigram of the name is added to the trigram index.
+ *
+ * @param student The student to be added.
+ */
+void addStudentToNameIndex(Student_t *student);
+
+/**
+ * @brief Removes a student from the name index.
+ *
+ * The student is found at the position kept in its name_position. Once half of the entries have no
+ * students left, the index is compacted: those entries are freed, the trigrams containing only them
+ * are freed, and the pointers returned by findNameEntry and findNameEntries are no longer valid.
+ * Nothing happens if the student is not in the index.
+ *
+ * @param student The student to be removed.
+ */
+void removeStudentFromNameIndex(Student_t *student);
+
+/**
+ * @brief Finds the entry of a name.
+ *
+ * @param name_offset The offset of the name in the string pool.
+ * @return A pointer to the entry of the name, NULL if the name has no entry. The entry may have no students.
+ */
+const NameEntry_t *findNameEntry(uint32_t name_offset);
+
+/**
+ * @brief Finds the names matching a pattern.
+ *
+ * This function takes the trigram of the pattern having the fewest names and checks only these names.
+ * A prefix is matched with the trigrams of the start of the names. A pattern shorter than a trigram
+ * is checked against every distinct name. Only the names of at least one student are returned.
+ *
+ * @param pattern The pattern to be found.
+ * @param match NAME_MATCH_PREFIX or NAME_MATCH_SUBSTRING.
+ * @param num_entries Pointer to a variable which receives the number of matching names.
+ * @return An array of pointers to the matching entries, which must be freed with free().
+ */
+const NameEntry_t **findNameEntries(const int8_t *pattern, NameMatch_t match, uint32_t *num_entries);
+
+/**
+ * @brief Gets the number of bytes allocated by the name index.
+ *
+ * @return The number of bytes of the entries, of the trigram index and of their hash tables.
+ */
+size_t getNameIndexBytes(void);
+
+/**
+ * @brief Releases the name index.
+ *
+ * This function frees every entry, every trigram and their hash tables.
+ */
+void releaseNameIndex(void);
+
+#endif /* NAME_INDEX_H */
@@ -0,0 +1,494 @@
+/**
+ * @file score_index.c
+ * @brief This file contains the function definitions for the score index of students.
+ *
+ * The file includes the function definitions of a skip list which indexes the students of the linked list
+ * by descending average score and ascending ID.
+ * The level of each node is chosen at random when it is inserted, the nodes are never rebalanced.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "score_index.h"        /* Include header file of this function file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SCORE_INDEX_SEED        2463534242u     /* The first state of the random number generator of the levels */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Allocates the head node of a score index.
+ *
+ * @param index The index whose head node is allocated.
+ */
+static void allocScoreHead(ScoreIndex_t *index);
+
+/**
+ * @brief Allocates a node for a student.
+ *
+ * @param index The index which the node belongs to.
+ * @param student The student of the node.
+ * @return A pointer to the node, with a random number of levels and its key set.
+ */
+static ScoreNode_t *allocScoreNode(ScoreIndex_t *index, Student_t *student);
+
+/**
+ * @brief Compares the position of two nodes in the score order.
+ *
+ * @param first The first node.
+ * @param second The second node.
+ * @return A negative value if first comes before second, a positive value if it comes after it, 0 otherwise.
+ */
+static int32_t compareScoreOrder(const ScoreNode_t *first, const ScoreNode_t *second);
+
+/**
+ * @brief Compares two pointers to nodes for the qsort function.
+ *
+ * @param first Pointer to the first pointer to a node.
+ * @param second Pointer to the second pointer to a node.
+ * @return The result of compareScoreOrder on the two nodes.
+ */
+static int compareScoreNodes(const void *first, const void *second);
+
+/**
+ * @brief Sets the key of a node from its student.
+ *
+ * @param node The node whose average score and ID prefix are set.
+ * @param student The student of the node.
+ */
+static void setScoreKey(ScoreNode_t *node, Student_t *student);
+
+/**
+ * @brief Chooses the level of a new node.
+ *
+ * @param index The index which the node is inserted into.
+ * @return The number of levels of the new node, between 1 and SCORE_INDEX_MAX_LEVEL.
+ */
+static int32_t chooseScoreLevel(ScoreIndex_t *index);
+
+/**
+ * @brief Finds the last node of each level which comes before a key.
+ *
+ * @param index The index to be searched.
+ * @param key The node holding the key whose position is searched.
+ * @param previous Array which receives the last node before the key at each level.
+ */
+static void findPreviousScoreNodes(const ScoreIndex_t *index, const ScoreNode_t *key,
+                                   ScoreNode_t *previous[SCORE_INDEX_MAX_LEVEL]);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Frees the nodes of a score index.
+ *
+ * This function frees every node of a score index, by following the lowest level, and makes the index empty.
+ * The students themselves are not freed.
+ *
+ * @param index The index to be freed.
+ */
+void freeScoreIndex(ScoreIndex_t *index)
+{
+    ScoreNode_t *node = index->head;    /* Temporary pointer to traverse the skip list */
+    ScoreNode_t *next = NULL;           /* The node after the freed node */
+
+    /* Free the head node and every node after it */
+    while (node != NULL)
+    {
+        next = node->next[0];
+        free(node);
+        node = next;
+    }
+    index->head = NULL;
+    index->level = 0;
+    index->count = 0;
+    index->bytes = 0;
+}
+
+/**
+ * @brief Builds a score index from a list of students.
+ *
+ * This function replaces the content of a score index by every student of a linked list.
+ * The nodes are sorted once with qsort and linked level by level in order, which is much faster than
+ * inserting the students one by one when the list is large.
+ *
+ * @param index The index to be built.
+ * @param first The first student of the list, NULL for an empty list.
+ */
+void buildScoreIndex(ScoreIndex_t *index, Student_t *first)
+{
+    ScoreNode_t *last[SCORE_INDEX_MAX_LEVEL];   /* The last linked node of each level */
+    ScoreNode_t **nodes = NULL;         /* The nodes of the students */
+    Student_t *student = first;         /* Temporary pointer to traverse the list */
+    uint32_t count = 0;                 /* The number of students of the list */
+    uint32_t i = 0;                     /* Index of each node */
+    int32_t level = 0;                  /* Index of each level */
+
+    freeScoreIndex(index);
+    allocScoreHead(index);
+
+    /* Count the students of the list */
+    while (student != NULL)
+    {
+        count++;
+        student = student->next;
+    }
+
+    /* Allocate a node for every student and sort the nodes */
+    nodes = (ScoreNode_t **)malloc((count > 0) ? (count * sizeof(ScoreNode_t *)) : 1);
+    for (student = first, i = 0; student != NULL; student = student->next, i++)
+    {
+        nodes[i] = allocScoreNode(index, student);
+    }
+    qsort(nodes, count, sizeof(ScoreNode_t *), compareScoreNodes);
+
+    /* Link the nodes in order at each of their levels */
+    for (level = 0; level < SCORE_INDEX_MAX_LEVEL; level++)
+    {
+        last[level] = index->head;
+    }
+    for (i = 0; i < count; i++)
+    {
+        for (level = 0; level < nodes[i]->level; level++)
+        {
+            last[level]->next[level] = nodes[i];
+            last[level] = nodes[i];
+        }
+        if (nodes[i]->level > index->level)
+        {
+            index->level = nodes[i]->level;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    for (level = 0; level < SCORE_INDEX_MAX_LEVEL; level++)
+    {
+        last[level]->next[level] = NULL;
+    }
+    index->count = count;
+    free(nodes);
+}
+
+/**
+ * @brief Inserts a student into a score index.
+ *
+ * This function inserts a student at its position in the score order.
+ * The head node of the skip list is allocated on the first insertion.
+ *
+ * @param index The index which the student is inserted into.
+ * @param student The student to be inserted.
+ */
+void insertStudentToScoreIndex(ScoreIndex_t *index, Student_t *student)
+{
+    ScoreNode_t *previous[SCORE_INDEX_MAX_LEVEL];   /* The last node before the student at each level */
+    ScoreNode_t *node = NULL;           /* The node of the student */
+    int32_t i = 0;                      /* Index of each level */
+
+    /* Allocate the head node on the first insertion */
+    if (index->head == NULL)
+    {
+        allocScoreHead(index);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    node = allocScoreNode(index, student);
+    findPreviousScoreNodes(index, node, previous);
+
+    /* The head node is the previous node of the levels which are not used yet */
+    for (i = index->level; i < node->level; i++)
+    {
+        previous[i] = index->head;
+    }
+    if (node->level > index->level)
+    {
+        index->level = node->level;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Link the new node after the previous node of each of its levels */
+    for (i = 0; i < node->level; i++)
+    {
+        node->next[i] = previous[i]->next[i];
+        previous[i]->next[i] = node;
+    }
+    index->count++;
+}
+
+/**
+ * @brief Removes a student from a score index.
+ *
+ * This function finds the node of the student by its average score and its ID and frees it.
+ * Nothing happens if the student is not in the index.
+ *
+ * @param index The index which the student is removed from.
+ * @param student The student to be removed.
+ */
+void removeStudentFromScoreIndex(ScoreIndex_t *index, Student_t *student)
+{
+    ScoreNode_t *previous[SCORE_INDEX_MAX_LEVEL];   /* The last node before the student at each level */
+    ScoreNode_t *node = NULL;           /* The node of the student */
+    ScoreNode_t key;                    /* The key of the student */
+    int32_t i = 0;                      /* Index of each level */
+
+    /* If the index is not empty, the node of the student follows the previous node of the lowest level */
+    if (index->head != NULL)
+    {
+        setScoreKey(&key, student);
+        findPreviousScoreNodes(index, &key, previous);
+        node = previous[0]->next[0];
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* If the student is found */
+    if ((node != NULL) && (node->student == student))
+    {
+        /* Unlink the node from each of its levels */
+        for (i = 0; i < node->level; i++)
+        {
+            previous[i]->next[i] = node->next[i];
+        }
+        /* Drop the levels which become empty */
+        while ((index->level > 1) && (index->head->next[index->level - 1] == NULL))
+        {
+            index->level--;
+        }
+        index->count--;
+        index->bytes -= sizeof(ScoreNode_t) + (size_t)node->level * sizeof(ScoreNode_t *);
+        free(node);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Finds the first node of a score index whose average score is not higher than a score.
+ *
+ * This function goes down from the highest level, skipping the nodes whose average score is higher
+ * than max_score. The following nodes, reached through next[0], have lower or equal average scores.
+ *
+ * @param index The index to be searched.
+ * @param max_score The highest average score to be found.
+ * @return A pointer to the first node whose average score is not higher than max_score, NULL if there is none.
+ */
+const ScoreNode_t *findScoreNode(const ScoreIndex_t *index, float max_score)
+{
+    const ScoreNode_t *node = index->head;  /* The last node whose average score is higher than max_score */
+    int32_t i = 0;                          /* Index of each level */
+
+    /* If the index is not empty */
+    if (node != NULL)
+    {
+        for (i = index->level - 1; i >= 0; i--)
+        {
+            /* Skip the nodes whose average score is higher than max_score */
+            while ((node->next[i] != NULL) && (node->next[i]->average_score > max_score))
+            {
+                node = node->next[i];
+            }
+        }
+        node = node->next[0];
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the first node whose average score is not higher than max_score */
+    return node;
+}
+
+/**
+ * @brief Allocates the head node of a score index.
+ *
+ * The head node has every level and no student, it comes before every other node.
+ *
+ * @param index The index whose head node is allocated.
+ */
+static void allocScoreHead(ScoreIndex_t *index)
+{
+    size_t node_size = sizeof(ScoreNode_t) + SCORE_INDEX_MAX_LEVEL * sizeof(ScoreNode_t *);   /* The number of bytes of the head node */
+    int32_t i = 0;                      /* Index of each level */
+
+    index->head = (ScoreNode_t *)malloc(node_size);
+    index->head->student = NULL;
+    index->head->average_score = 0;
+    index->head->level = SCORE_INDEX_MAX_LEVEL;
+    index->head->id_prefix = 0;
+    for (i = 0; i < SCORE_INDEX_MAX_LEVEL; i++)
+    {
+        index->head->next[i] = NULL;
+    }
+    index->level = 1;
+    index->bytes = node_size;
+    index->random_state = SCORE_INDEX_SEED;
+}
+
+/**
+ * @brief Allocates a node for a student.
+ *
+ * @param index The index which the node belongs to.
+ * @param student The student of the node.
+ * @return A pointer to the node, with a random number of levels and its key set.
+ */
+static ScoreNode_t *allocScoreNode(ScoreIndex_t *index, Student_t *student)
+{
+    int32_t level = chooseScoreLevel(index);    /* The number of levels of the node */
+    size_t node_size = sizeof(ScoreNode_t) + (size_t)level * sizeof(ScoreNode_t *);    /* The number of bytes of the node */
+    ScoreNode_t *node = (ScoreNode_t *)malloc(node_size);  /* The new node */
+
+    setScoreKey(node, student);
+    node->level = level;
+    index->bytes += node_size;
+    /* Return the new node */
+    return node;
+}
+
+/**
+ * @brief Compares the position of two nodes in the score order.
+ *
+ * The nodes are ordered by descending average score, then by ascending ID. The IDs are first compared
+ * by their prefixes stored in the nodes, the students are only read when the prefixes are equal.
+ *
+ * @param first The first node.
+ * @param second The second node.
+ * @return A negative value if first comes before second, a positive value if it comes after it, 0 otherwise.
+ */
+static int32_t compareScoreOrder(const ScoreNode_t *first, const ScoreNode_t *second)
+{
+    int32_t result = 0;         /* Initialize result to 0 */
+
+    if (first->average_score > second->average_score)
+    {
+        result = -1;
+    }
+    else if (first->average_score < second->average_score)
+    {
+        result = 1;
+    }
+    else if (first->id_prefix < second->id_prefix)
+    {
+        result = -1;
+    }
+    else if (first->id_prefix > second->id_prefix)
+    {
+        result = 1;
+    }
+    else
+    {
+        result = strcmp(first->student->ID, second->student->ID);
+    }
+    /* Return the result of the comparison */
+    return result;
+}
+
+/**
+ * @brief Compares two pointers to nodes for the qsort function.
+ *
+ * @param first Pointer to the first pointer to a node.
+ * @param second Pointer to the second pointer to a node.
+ * @return The result of compareScoreOrder on the two nodes.
+ */
+static int compareScoreNodes(const void *first, const void *second)
+{
+    /* Return the result of the comparison of the nodes */
+    return compareScoreOrder(*(ScoreNode_t *const *)first, *(ScoreNode_t *const *)second);
+}
+
+/**
+ * @brief Sets the key of a node from its student.
+ *
+ * This function copies the average score of the student into the node and packs the first 8 characters
+ * of its ID into a big-endian number, padded with zeros, so comparing two prefixes gives the same order
+ * as comparing the first 8 characters of the IDs with strcmp.
+ *
+ * @param node The node whose average score and ID prefix are set.
+ * @param student The student of the node.
+ */
+static void setScoreKey(ScoreNode_t *node, Student_t *student)
+{
+    uint64_t prefix = 0;            /* The prefix of the ID */
+    int32_t is_end = 0;             /* 1 when the end of the ID is reached */
+    int32_t i = 0;                  /* Index of each character of the prefix */
+
+    for (i = 0; i < 8; i++)
+    {
+        is_end = is_end || (student->ID[i] == '\0');
+        prefix = (prefix << 8) | (is_end ? 0u : (uint8_t)student->ID[i]);
+    }
+    node->student = student;
+    node->average_score = student->average_score;
+    node->id_prefix = prefix;
+}
+
+/**
+ * @brief Chooses the level of a new node.
+ *
+ * This function adds one level to the node while two random bits are both 0,
+ * so each level holds about a quarter of the nodes of the level below it.
+ *
+ * @param index The index which the node is inserted into.
+ * @return The number of levels of the new node, between 1 and SCORE_INDEX_MAX_LEVEL.
+ */
+static int32_t chooseScoreLevel(ScoreIndex_t *index)
+{
+    int32_t level = 1;                          /* Initialize level to 1 */
+    uint32_t random = index->random_state;      /* The next random number of the index */
+
+    /* Compute the next random number with a xorshift generator */
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    index->random_state = random;
+
+    /* Add one level for each pair of zero bits */
+    while (((random & 3u) == 0) && (level < SCORE_INDEX_MAX_LEVEL))
+    {
+        level++;
+        random >>= 2;
+    }
+    /* Return the level of the node */
+    return level;
+}
+
+/**
+ * @brief Finds the last node of each level which comes before a key.
+ *
+ * @param index The index to be searched, its head node must be allocated.
+ * @param key The node holding the key whose position is searched.
+ * @param previous Array which receives the last node before the key at each level.
+ */
+static void findPreviousScoreNodes(const ScoreIndex_t *index, const ScoreNode_t *key,
+                                   ScoreNode_t *previous[SCORE_INDEX_MAX_LEVEL])
+{
+    ScoreNode_t *node = index->head;    /* The last node before the key at the current level */
+    int32_t i = 0;                      /* Index of each level */
+
+    for (i = index->level - 1; i >= 0; i--)
+    {
+        /* Skip the nodes which come before the key */
+        while ((node->next[i] != NULL) && (compareScoreOrder(node->next[i], key) < 0))
+        {
+            node = node->next[i];
+        }
+        previous[i] = node;
+    }
+} /* EOF */
@@ -0,0 +1,126 @@
+/**
+ * @file score_index.h
+ * @brief This file contains the function prototypes and data structures for the score index of students.
+ *
+ * This file contains the function prototypes and data structures of a skip list which keeps the students
+ * of the linked list ordered by their average score, so the students of a range of scores or the students
+ * having the best scores are found without sorting the list.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For malloc(), free() functions */
+#include <string.h>             /* For strcmp() function */
+#include "manage_students.h"    /* Include header file for the Student_t structure */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef SCORE_INDEX_H
+#define SCORE_INDEX_H
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SCORE_INDEX_MAX_LEVEL   16      /* The maximum number of levels of the skip list */
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct ScoreNode
+ * @brief This structure represents a node of the score index.
+ *
+ * This structure represents a node of the skip list. It points to a student of the linked list,
+ * keeps a copy of its sort key so most comparisons do not read the student, and holds one forward pointer
+ * per level of the node.
+ */
+typedef struct ScoreNode
+{
+    Student_t *student;             /* Pointer to the student of the node */
+    float average_score;            /* The average score of the student */
+    int32_t level;                  /* The number of levels of the node */
+    uint64_t id_prefix;             /* The first 8 characters of the ID of the student, as a big-endian number */
+    struct ScoreNode *next[];       /* The next node of each level of the node */
+} ScoreNode_t;
+
+/**
+ * @struct ScoreIndex
+ * @brief This structure represents a score index of students.
+ *
+ * This structure represents a skip list ordered by descending average score, students having the same
+ * average score are ordered by ascending ID. Each node has one level more than the level below it
+ * with a probability of 1/4, so a search visits O(log n) nodes.
+ */
+typedef struct ScoreIndex
+{
+    ScoreNode_t *head;              /* The head node of the skip list, it has every level and no student */
+    int32_t level;                  /* The number of levels in use */
+    uint32_t count;                 /* The number of students in the skip list */
+    size_t bytes;                   /* The number of bytes allocated for the nodes */
+    uint32_t random_state;          /* The state of the random number generator of the levels */
+} ScoreIndex_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Frees the nodes of a score index.
+ *
+ * This function frees every node of a score index and makes the index empty.
+ * The students themselves are not freed.
+ *
+ * @param index The index to be freed.
+ */
+void freeScoreIndex(ScoreIndex_t *index);
+
+/**
+ * @brief Builds a score index from a list of students.
+ *
+ * This function replaces the content of a score index by every student of a linked list,
+ * by sorting the students once instead of inserting them one by one.
+ *
+ * @param index The index to be built.
+ * @param first The first student of the list, NULL for an empty list.
+ */
+void buildScoreIndex(ScoreIndex_t *index, Student_t *first);
+
+/**
+ * @brief Inserts a student into a score index.
+ *
+ * This function inserts a student at its position in the score order.
+ * The head node of the skip list is allocated on the first insertion.
+ *
+ * @param index The index which the student is inserted into.
+ * @param student The student to be inserted.
+ */
+void insertStudentToScoreIndex(ScoreIndex_t *index, Student_t *student);
+
+/**
+ * @brief Removes a student from a score index.
+ *
+ * This function finds the node of the student by its average score and its ID and frees it.
+ * Nothing happens if the student is not in the index.
+ *
+ * @param index The index which the student is removed from.
+ * @param student The student to be removed.
+ */
+void removeStudentFromScoreIndex(ScoreIndex_t *index, Student_t *student);
+
+/**
+ * @brief Finds the first node of a score index whose average score is not higher than a score.
+ *
+ * The following nodes, reached through next[0], have lower or equal average scores.
+ *
+ * @param index The index to be searched.
+ * @param max_score The highest average score to be found.
+ * @return A pointer to the first node whose average score is not higher than max_score, NULL if there is none.
+ */
+const ScoreNode_t *findScoreNode(const ScoreIndex_t *index, float max_score);
+
+#endif /* SCORE_INDEX_H */
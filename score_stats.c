@@ -0,0 +1,438 @@
+/**
+ * @file score_stats.c
+ * @brief This file contains the function definitions for the statistics of average scores.
+ *
+ * The file includes the function definitions of the kernels which accumulate the statistics of an array
+ * of average scores. Each vector kernel keeps the lowest and highest scores, two sums in double precision
+ * and, for each bound between two bands, the number of scores lower than the bound in vector registers,
+ * so a score is read once and never branched on. The histogram is made from these numbers at the end.
+ * The AVX2 kernel is built with GCC on x86 and only runs if the processor supports AVX2.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "score_stats.h"        /* Include header file of this function file */
+#include <float.h>              /* For FLT_MAX definition */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>          /* For the AVX2 and SSE2 intrinsics */
+#define SCORE_STATS_AVX2        /* The AVX2 kernel is built */
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>          /* For the SSE2 intrinsics */
+#define SCORE_STATS_SSE2        /* The SSE2 kernel is built */
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SCORE_STATS_BOUNDS  (CLASS_STATS_BANDS - 1)     /* The number of bounds between two bands */
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 8)
+#define SCORE_STATS_UNROLL  _Pragma("GCC unroll 16")    /* Unrolls the loop of the bounds, so the counters stay in registers */
+#else
+#define SCORE_STATS_UNROLL
+#endif
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @brief Pointer to a kernel which accumulates an array of average scores.
+ */
+typedef void (*ScoreKernel_t)(ScoreStats_t *stats, const float *scores, uint32_t count);
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Chooses the fastest kernel which the processor supports.
+ */
+static void selectScoreKernel(void);
+
+/**
+ * @brief Accumulates an array of average scores one score at a time.
+ *
+ * @param stats The accumulator.
+ * @param scores The scores to be accumulated.
+ * @param count The number of scores.
+ */
+static void accumulateScalar(ScoreStats_t *stats, const float *scores, uint32_t count);
+
+/**
+ * @brief Adds the numbers of scores lower than each bound to the bands of an accumulator.
+ *
+ * @param stats The accumulator.
+ * @param below The number of scores lower than each bound, the bound of index i being i + 1.
+ * @param count The number of scores which were counted.
+ */
+static void addBandCounts(ScoreStats_t *stats, const uint64_t *below, uint64_t count);
+
+#ifdef SCORE_STATS_AVX2
+/**
+ * @brief Accumulates an array of average scores eight scores at a time with AVX2.
+ *
+ * @param stats The accumulator.
+ * @param scores The scores to be accumulated.
+ * @param count The number of scores.
+ */
+static void accumulateAvx2(ScoreStats_t *stats, const float *scores, uint32_t count);
+#endif
+
+#ifdef SCORE_STATS_SSE2
+/**
+ * @brief Accumulates an array of average scores four scores at a time with SSE2.
+ *
+ * @param stats The accumulator.
+ * @param scores The scores to be accumulated.
+ * @param count The number of scores.
+ */
+static void accumulateSse2(ScoreStats_t *stats, const float *scores, uint32_t count);
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static ScoreKernel_t score_kernel = NULL;       /* The kernel which accumulates the scores, NULL until it is chosen */
+static const char *kernel_name = "scalar";      /* The name of the kernel */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Makes an accumulator empty.
+ *
+ * @param stats The accumulator.
+ */
+void initScoreStats(ScoreStats_t *stats)
+{
+    uint32_t band = 0;          /* Index of each band */
+
+    stats->count = 0;
+    stats->sum = 0.0;
+    stats->sum_squares = 0.0;
+    stats->min_score = FLT_MAX;
+    stats->max_score = -FLT_MAX;
+    for (band = 0; band < CLASS_STATS_BANDS; band++)
+    {
+        stats->bands[band] = 0;
+    }
+}
+
+/**
+ * @brief Accumulates an array of average scores.
+ *
+ * This function runs the kernel chosen on its first call.
+ *
+ * @param stats The accumulator.
+ * @param scores The scores to be accumulated.
+ * @param count The number of scores.
+ */
+void accumulateScoreStats(ScoreStats_t *stats, const float *scores, uint32_t count)
+{
+    if (score_kernel == NULL)
+    {
+        selectScoreKernel();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    score_kernel(stats, scores, count);
+}
+
+/**
+ * @brief Computes the statistics of the accumulated scores.
+ *
+ * The variance is the mean of the squares minus the square of the mean. The scores are small and the sums
+ * are in double precision, so the cancellation only costs digits far below the precision of a float.
+ *
+ * @param stats The accumulator.
+ * @param statistics Pointer to a structure which receives the statistics.
+ */
+void finishScoreStats(const ScoreStats_t *stats, ClassStatistics_t *statistics)
+{
+    double variance = 0.0;      /* The variance of the scores */
+    uint32_t band = 0;          /* Index of each band */
+
+    statistics->num_students = (int32_t)stats->count;
+    if (stats->count > 0)
+    {
+        statistics->mean = stats->sum / (double)stats->count;
+        variance = (stats->sum_squares / (double)stats->count) - (statistics->mean * statistics->mean);
+        statistics->std_dev = (variance > 0.0) ? sqrt(variance) : 0.0;
+        statistics->min_score = stats->min_score;
+        statistics->max_score = stats->max_score;
+    }
+    else
+    {
+        statistics->mean = 0.0;
+        statistics->std_dev = 0.0;
+        statistics->min_score = 0.0f;
+        statistics->max_score = 0.0f;
+    }
+    for (band = 0; band < CLASS_STATS_BANDS; band++)
+    {
+        statistics->bands[band] = (uint32_t)stats->bands[band];
+    }
+}
+
+/**
+ * @brief Gets the name of the kernel which accumulates the scores.
+ *
+ * @return "avx2", "sse2" or "scalar".
+ */
+const char *getScoreStatsKernel(void)
+{
+    if (score_kernel == NULL)
+    {
+        selectScoreKernel();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the name of the kernel */
+    return kernel_name;
+}
+
+/**
+ * @brief Chooses the fastest kernel which the processor supports.
+ */
+static void selectScoreKernel(void)
+{
+    score_kernel = accumulateScalar;
+    kernel_name = "scalar";
+#ifdef SCORE_STATS_SSE2
+    score_kernel = accumulateSse2;
+    kernel_name = "sse2";
+#endif
+#ifdef SCORE_STATS_AVX2
+    if (__builtin_cpu_supports("avx2"))
+    {
+        score_kernel = accumulateAvx2;
+        kernel_name = "avx2";
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+}
+
+/**
+ * @brief Accumulates an array of average scores one score at a time.
+ *
+ * The vector kernels also use this function for the scores after their last full vector.
+ *
+ * @param stats The accumulator.
+ * @param scores The scores to be accumulated.
+ * @param count The number of scores.
+ */
+static void accumulateScalar(ScoreStats_t *stats, const float *scores, uint32_t count)
+{
+    float score = 0.0f;         /* Each score */
+    uint32_t band = 0;          /* The band of each score */
+    uint32_t i = 0;             /* Index of each score */
+
+    for (i = 0; i < count; i++)
+    {
+        score = scores[i];
+        stats->sum += (double)score;
+        stats->sum_squares += (double)score * (double)score;
+        stats->min_score = (score < stats->min_score) ? score : stats->min_score;
+        stats->max_score = (score > stats->max_score) ? score : stats->max_score;
+        /* A score which is not lower than the last bound, or not a number, is in the last band like in the vector kernels */
+        band = (score < 1.0f) ? 0 : ((score < (float)SCORE_STATS_BOUNDS) ? (uint32_t)score : SCORE_STATS_BOUNDS);
+        stats->bands[band]++;
+    }
+    stats->count += count;
+}
+
+/**
+ * @brief Adds the numbers of scores lower than each bound to the bands of an accumulator.
+ *
+ * @param stats The accumulator.
+ * @param below The number of scores lower than each bound, the bound of index i being i + 1.
+ * @param count The number of scores which were counted.
+ */
+static void addBandCounts(ScoreStats_t *stats, const uint64_t *below, uint64_t count)
+{
+    uint32_t bound = 0;         /* Index of each bound */
+
+    stats->bands[0] += below[0];
+    for (bound = 1; bound < SCORE_STATS_BOUNDS; bound++)
+    {
+        stats->bands[bound] += below[bound] - below[bound - 1];
+    }
+    stats->bands[SCORE_STATS_BOUNDS] += count - below[SCORE_STATS_BOUNDS - 1];
+    stats->count += count;
+}
+
+#ifdef SCORE_STATS_AVX2
+/**
+ * @brief Accumulates an array of average scores eight scores at a time with AVX2.
+ *
+ * Each comparison gives -1 in the lanes whose score is lower than the bound, so subtracting it counts them.
+ * The scores are widened to double precision before they are added.
+ *
+ * @param stats The accumulator.
+ * @param scores The scores to be accumulated.
+ * @param count The number of scores.
+ */
+__attribute__((target("avx2")))
+static void accumulateAvx2(ScoreStats_t *stats, const float *scores, uint32_t count)
+{
+    __m256 min_vector = _mm256_set1_ps(stats->min_score);   /* The lowest score of each lane */
+    __m256 max_vector = _mm256_set1_ps(stats->max_score);   /* The highest score of each lane */
+    __m256d sums[2] = {_mm256_setzero_pd(), _mm256_setzero_pd()};       /* The sums of the low and high lanes */
+    __m256d squares[2] = {_mm256_setzero_pd(), _mm256_setzero_pd()};    /* The sums of squares of the low and high lanes */
+    __m256i below[SCORE_STATS_BOUNDS];                      /* The number of scores lower than each bound, per lane */
+    __m256 vector;                                          /* Each vector of eight scores */
+    __m256d wide;                                           /* Four scores of the vector in double precision */
+    float lanes[8];                                         /* The lanes of the lowest or highest scores */
+    double totals[4];                                       /* The lanes of the sums */
+    int32_t counts[8];                                      /* The lanes of a number of scores */
+    uint64_t below_counts[SCORE_STATS_BOUNDS];              /* The number of scores lower than each bound */
+    uint32_t bound = 0;                                     /* Index of each bound */
+    uint32_t lane = 0;                                      /* Index of each lane */
+    uint32_t i = 0;                                         /* Index of each vector */
+
+    for (bound = 0; bound < SCORE_STATS_BOUNDS; bound++)
+    {
+        below[bound] = _mm256_setzero_si256();
+    }
+    for (i = 0; (i + 8) <= count; i += 8)
+    {
+        vector = _mm256_loadu_ps(&scores[i]);
+        /* The second operand is kept if the score is not a number */
+        min_vector = _mm256_min_ps(vector, min_vector);
+        max_vector = _mm256_max_ps(vector, max_vector);
+        wide = _mm256_cvtps_pd(_mm256_castps256_ps128(vector));
+        sums[0] = _mm256_add_pd(sums[0], wide);
+        squares[0] = _mm256_add_pd(squares[0], _mm256_mul_pd(wide, wide));
+        wide = _mm256_cvtps_pd(_mm256_extractf128_ps(vector, 1));
+        sums[1] = _mm256_add_pd(sums[1], wide);
+        squares[1] = _mm256_add_pd(squares[1], _mm256_mul_pd(wide, wide));
+        SCORE_STATS_UNROLL
+        for (bound = 0; bound < SCORE_STATS_BOUNDS; bound++)
+        {
+            below[bound] = _mm256_sub_epi32(below[bound], _mm256_castps_si256(
+                               _mm256_cmp_ps(vector, _mm256_set1_ps((float)(bound + 1)), _CMP_LT_OQ)));
+        }
+    }
+
+    /* Reduce the lanes of each vector of the accumulator */
+    _mm256_storeu_ps(lanes, min_vector);
+    for (lane = 0; lane < 8; lane++)
+    {
+        stats->min_score = (lanes[lane] < stats->min_score) ? lanes[lane] : stats->min_score;
+    }
+    _mm256_storeu_ps(lanes, max_vector);
+    for (lane = 0; lane < 8; lane++)
+    {
+        stats->max_score = (lanes[lane] > stats->max_score) ? lanes[lane] : stats->max_score;
+    }
+    _mm256_storeu_pd(totals, _mm256_add_pd(sums[0], sums[1]));
+    stats->sum += (totals[0] + totals[1]) + (totals[2] + totals[3]);
+    _mm256_storeu_pd(totals, _mm256_add_pd(squares[0], squares[1]));
+    stats->sum_squares += (totals[0] + totals[1]) + (totals[2] + totals[3]);
+    for (bound = 0; bound < SCORE_STATS_BOUNDS; bound++)
+    {
+        _mm256_storeu_si256((__m256i *)counts, below[bound]);
+        below_counts[bound] = 0;
+        for (lane = 0; lane < 8; lane++)
+        {
+            below_counts[bound] += (uint32_t)counts[lane];
+        }
+    }
+    addBandCounts(stats, below_counts, i);
+
+    /* Accumulate the scores after the last full vector */
+    accumulateScalar(stats, &scores[i], count - i);
+}
+#endif
+
+#ifdef SCORE_STATS_SSE2
+/**
+ * @brief Accumulates an array of average scores four scores at a time with SSE2.
+ *
+ * This kernel works like accumulateAvx2 on vectors half as wide.
+ *
+ * @param stats The accumulator.
+ * @param scores The scores to be accumulated.
+ * @param count The number of scores.
+ */
+static void accumulateSse2(ScoreStats_t *stats, const float *scores, uint32_t count)
+{
+    __m128 min_vector = _mm_set1_ps(stats->min_score);      /* The lowest score of each lane */
+    __m128 max_vector = _mm_set1_ps(stats->max_score);      /* The highest score of each lane */
+    __m128d sums[2] = {_mm_setzero_pd(), _mm_setzero_pd()};         /* The sums of the low and high lanes */
+    __m128d squares[2] = {_mm_setzero_pd(), _mm_setzero_pd()};      /* The sums of squares of the low and high lanes */
+    __m128i below[SCORE_STATS_BOUNDS];                      /* The number of scores lower than each bound, per lane */
+    __m128 vector;                                          /* Each vector of four scores */
+    __m128d wide;                                           /* Two scores of the vector in double precision */
+    float lanes[4];                                         /* The lanes of the lowest or highest scores */
+    double totals[2];                                       /* The lanes of the sums */
+    int32_t counts[4];                                      /* The lanes of a number of scores */
+    uint64_t below_counts[SCORE_STATS_BOUNDS];              /* The number of scores lower than each bound */
+    uint32_t bound = 0;                                     /* Index of each bound */
+    uint32_t lane = 0;                                      /* Index of each lane */
+    uint32_t i = 0;                                         /* Index of each vector */
+
+    for (bound = 0; bound < SCORE_STATS_BOUNDS; bound++)
+    {
+        below[bound] = _mm_setzero_si128();
+    }
+    for (i = 0; (i + 4) <= count; i += 4)
+    {
+        vector = _mm_loadu_ps(&scores[i]);
+        /* The second operand is kept if the score is not a number */
+        min_vector = _mm_min_ps(vector, min_vector);
+        max_vector = _mm_max_ps(vector, max_vector);
+        wide = _mm_cvtps_pd(vector);
+        sums[0] = _mm_add_pd(sums[0], wide);
+        squares[0] = _mm_add_pd(squares[0], _mm_mul_pd(wide, wide));
+        wide = _mm_cvtps_pd(_mm_movehl_ps(vector, vector));
+        sums[1] = _mm_add_pd(sums[1], wide);
+        squares[1] = _mm_add_pd(squares[1], _mm_mul_pd(wide, wide));
+        SCORE_STATS_UNROLL
+        for (bound = 0; bound < SCORE_STATS_BOUNDS; bound++)
+        {
+            below[bound] = _mm_sub_epi32(below[bound], _mm_castps_si128(
+                               _mm_cmplt_ps(vector, _mm_set1_ps((float)(bound + 1)))));
+        }
+    }
+
+    /* Reduce the lanes of each vector of the accumulator */
+    _mm_storeu_ps(lanes, min_vector);
+    for (lane = 0; lane < 4; lane++)
+    {
+        stats->min_score = (lanes[lane] < stats->min_score) ? lanes[lane] : stats->min_score;
+    }
+    _mm_storeu_ps(lanes, max_vector);
+    for (lane = 0; lane < 4; lane++)
+    {
+        stats->max_score = (lanes[lane] > stats->max_score) ? lanes[lane] : stats->max_score;
+    }
+    _mm_storeu_pd(totals, _mm_add_pd(sums[0], sums[1]));
+    stats->sum += totals[0] + totals[1];
+    _mm_storeu_pd(totals, _mm_add_pd(squares[0], squares[1]));
+    stats->sum_squares += totals[0] + totals[1];
+    for (bound = 0; bound < SCORE_STATS_BOUNDS; bound++)
+    {
+        _mm_storeu_si128((__m128i *)counts, below[bound]);
+        below_counts[bound] = 0;
+        for (lane = 0; lane < 4; lane++)
+        {
+            below_counts[bound] += (uint32_t)counts[lane];
+        }
+    }
+    addBandCounts(stats, below_counts, i);
+
+    /* Accumulate the scores after the last full vector */
+    accumulateScalar(stats, &scores[i], count - i);
+}
+#endif /* EOF */
@@ -0,0 +1,94 @@
+/**
+ * @file score_stats.h
+ * @brief This file contains the function prototypes and data structures for the statistics of average scores.
+ *
+ * This file contains the function prototypes and data structures of a kernel which computes the count,
+ * the sum, the sum of squares, the lowest and highest values and the histogram by band of an array of
+ * average scores in one pass. The pass runs on AVX2 or SSE2 vectors when the processor has them, and on
+ * a scalar loop otherwise. An accumulator may receive several arrays, so scores which are not contiguous
+ * are gathered into a small buffer and accumulated one buffer at a time.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <math.h>               /* For sqrt() function */
+#include "manage_students.h"    /* Include header file for the ClassStatistics_t structure */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef SCORE_STATS_H
+#define SCORE_STATS_H
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SCORE_STATS_CHUNK_SIZE  1024u       /* The number of scores gathered into the buffer before each accumulation */
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct ScoreStats
+ * @brief This structure represents the accumulated statistics of average scores.
+ *
+ * The sums are kept in double precision, so the mean and the standard deviation of millions of scores
+ * do not depend on the order or on the width of the vectors which accumulate them.
+ */
+typedef struct ScoreStats
+{
+    uint64_t count;                         /* The number of scores */
+    double sum;                             /* The sum of the scores */
+    double sum_squares;                     /* The sum of the squares of the scores */
+    float min_score;                        /* The lowest score */
+    float max_score;                        /* The highest score */
+    uint64_t bands[CLASS_STATS_BANDS];      /* The number of scores of each band */
+} ScoreStats_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Makes an accumulator empty.
+ *
+ * @param stats The accumulator.
+ */
+void initScoreStats(ScoreStats_t *stats);
+
+/**
+ * @brief Accumulates an array of average scores.
+ *
+ * This function reads every score once. Band i receives the scores from i included to i + 1 excluded,
+ * the first band also receives the scores lower than 1 and the last band the scores from
+ * CLASS_STATS_BANDS - 1 upwards.
+ *
+ * @param stats The accumulator.
+ * @param scores The scores to be accumulated.
+ * @param count The number of scores.
+ */
+void accumulateScoreStats(ScoreStats_t *stats, const float *scores, uint32_t count);
+
+/**
+ * @brief Computes the statistics of the accumulated scores.
+ *
+ * The standard deviation is the one of the population of the scores. Every field is 0 if no score
+ * has been accumulated.
+ *
+ * @param stats The accumulator.
+ * @param statistics Pointer to a structure which receives the statistics.
+ */
+void finishScoreStats(const ScoreStats_t *stats, ClassStatistics_t *statistics);
+
+/**
+ * @brief Gets the name of the kernel which accumulates the scores.
+ *
+ * @return "avx2", "sse2" or "scalar".
+ */
+const char *getScoreStatsKernel(void);
+
+#endif /* SCORE_STATS_H */
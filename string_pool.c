@@ -0,0 +1,314 @@
+/**
+ * @file string_pool.c
+ * @brief This file contains the function definitions for the pool of interned strings.
+ *
+ * The file includes the function definitions of a pool which stores variable-length strings back to back
+ * in one growing buffer. An open-addressing hash table of offsets makes sure that each string is stored once.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "string_pool.h"        /* Include header file of this function file */
+#include "student_index.h"      /* Include header file for the hashStudentKey function */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define POOL_MIN_DATA_SIZE      4096u       /* The size of a newly allocated buffer */
+#define POOL_MIN_SLOTS          256u        /* The capacity of a newly allocated hash table */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static int8_t *pool_data = NULL;            /* The buffer which stores the strings */
+static uint32_t pool_size = 0;              /* The number of used bytes of the buffer */
+static uint32_t pool_capacity = 0;          /* The number of allocated bytes of the buffer */
+static uint32_t *pool_slots = NULL;         /* The hash table, each slot stores the offset of a string plus one, 0 when empty */
+static uint32_t pool_slot_capacity = 0;     /* The number of slots of the hash table, always a power of two */
+static uint32_t pool_count = 0;             /* The number of strings of the pool */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Finds the slot of a string in the hash table.
+ *
+ * This function probes the hash table from the hash value of the string until it finds the slot
+ * holding the string or an empty slot.
+ *
+ * @param str The string to be found.
+ * @return The position of the slot.
+ */
+static uint32_t findPoolSlot(const int8_t *str);
+
+/**
+ * @brief Doubles the capacity of the hash table.
+ */
+static void growPoolSlots(void);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Interns a string into the pool.
+ *
+ * This function returns the offset of the string in the pool.
+ * If the string is not in the pool yet, it is appended to the buffer of the pool first.
+ *
+ * @param str The string to be interned.
+ * @return The offset of the string in the pool.
+ */
+uint32_t internString(const int8_t *str)
+{
+    uint32_t length = (uint32_t)strlen(str) + 1;    /* The number of bytes of the string including the null terminator */
+    uint32_t offset = 0;                            /* The offset of the string in the pool */
+    uint32_t pos = 0;                               /* The position of the slot of the string */
+
+    /* Keep the hash table at most half full */
+    if ((pool_count + 1) * 2 > pool_slot_capacity)
+    {
+        growPoolSlots();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    pos = findPoolSlot(str);
+    /* If the string is already in the pool, return its offset */
+    if (pool_slots[pos] != 0)
+    {
+        offset = pool_slots[pos] - 1;
+    }
+    else
+    {
+        /* Grow the buffer if the string does not fit */
+        if (pool_size + length > pool_capacity)
+        {
+            pool_capacity = (pool_capacity == 0) ? POOL_MIN_DATA_SIZE : pool_capacity;
+            while (pool_size + length > pool_capacity)
+            {
+                pool_capacity *= 2;
+            }
+            pool_data = (int8_t *)realloc(pool_data, pool_capacity);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        /* Append the string to the buffer */
+        offset = pool_size;
+        memcpy(&pool_data[offset], str, length);
+        pool_size += length;
+        /* Store the offset in the hash table */
+        pool_slots[pos] = offset + 1;
+        pool_count++;
+    }
+    /* Return the offset of the string */
+    return offset;
+}
+
+/**
+ * @brief Finds a string in the pool.
+ *
+ * This function returns the offset of the string if it has been interned, STRING_POOL_NONE otherwise.
+ * The pool is not modified.
+ *
+ * @param str The string to be found.
+ * @return The offset of the string in the pool, or STRING_POOL_NONE.
+ */
+uint32_t findPooledString(const int8_t *str)
+{
+    uint32_t offset = STRING_POOL_NONE;     /* Initialize offset to STRING_POOL_NONE */
+    uint32_t pos = 0;                       /* The position of the slot of the string */
+
+    /* If the hash table is allocated */
+    if (pool_slot_capacity != 0)
+    {
+        pos = findPoolSlot(str);
+        /* If the string is in the pool, get its offset */
+        if (pool_slots[pos] != 0)
+        {
+            offset = pool_slots[pos] - 1;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the offset of the string */
+    return offset;
+}
+
+/**
+ * @brief Gets a string of the pool by its offset.
+ *
+ * The returned pointer is only valid until the next string is interned, because the buffer of the pool
+ * may be moved when it grows.
+ *
+ * @param offset The offset of the string in the pool.
+ * @return A pointer to the string.
+ */
+const int8_t *getPooledString(uint32_t offset)
+{
+    return &pool_data[offset];
+}
+
+/**
+ * @brief Gets the number of bytes allocated by the pool.
+ *
+ * @return The number of bytes of the buffer and of the hash table of the pool.
+ */
+size_t getStringPoolBytes(void)
+{
+    return (size_t)pool_capacity + (size_t)pool_slot_capacity * sizeof(uint32_t);
+}
+
+/**
+ * @brief Starts a compact copy of the pool.
+ *
+ * This function allocates a buffer of the size of the pool and a table of the copied offsets with one
+ * entry per slot of the hash table, so a string is found in the copy through the slot it has in the pool.
+ *
+ * @param copy The copy to be started, freed by freeStringPoolCopy.
+ * @return 1 if the copy is started, 0 if the memory cannot be allocated.
+ */
+int32_t beginStringPoolCopy(StringPoolCopy_t *copy)
+{
+    int32_t is_started = 0;     /* Initialize is_started to 0 */
+
+    copy->data = (int8_t *)malloc((pool_size > 0) ? pool_size : 1);
+    copy->size = 0;
+    copy->copied_offsets = (uint32_t *)calloc((pool_slot_capacity > 0) ? pool_slot_capacity : 1, sizeof(uint32_t));
+    /* If both arrays are allocated */
+    if ((copy->data != NULL) && (copy->copied_offsets != NULL))
+    {
+        is_started = 1;
+    }
+    else
+    {
+        freeStringPoolCopy(copy);
+    }
+    /* Return the value of is_started */
+    return is_started;
+}
+
+/**
+ * @brief Copies a string of the pool into a compact copy.
+ *
+ * This function finds the slot of the string in the hash table of the pool. The string is appended to
+ * the buffer of the copy if the slot has no copied offset yet, otherwise its copied offset is returned.
+ *
+ * @param copy The copy started by beginStringPoolCopy.
+ * @param offset The offset of the string in the pool.
+ * @return The offset of the string in the buffer of the copy.
+ */
+uint32_t copyPooledString(StringPoolCopy_t *copy, uint32_t offset)
+{
+    uint32_t pos = findPoolSlot(&pool_data[offset]);                /* The position of the slot of the string */
+    uint32_t length = (uint32_t)strlen(&pool_data[offset]) + 1;     /* The number of bytes of the string */
+
+    /* Append the string the first time it is copied */
+    if (copy->copied_offsets[pos] == 0)
+    {
+        memcpy(&copy->data[copy->size], &pool_data[offset], length);
+        copy->copied_offsets[pos] = copy->size + 1;
+        copy->size += length;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the offset of the string in the copy */
+    return copy->copied_offsets[pos] - 1;
+}
+
+/**
+ * @brief Frees a compact copy of the pool.
+ *
+ * @param copy The copy to be freed.
+ */
+void freeStringPoolCopy(StringPoolCopy_t *copy)
+{
+    free(copy->data);
+    free(copy->copied_offsets);
+    copy->data = NULL;
+    copy->size = 0;
+    copy->copied_offsets = NULL;
+}
+
+/**
+ * @brief Releases every string of the pool.
+ *
+ * This function frees the buffer and the hash table of the pool. Every offset returned before becomes invalid.
+ */
+void releaseStringPool(void)
+{
+    free(pool_data);
+    free(pool_slots);
+    pool_data = NULL;
+    pool_size = 0;
+    pool_capacity = 0;
+    pool_slots = NULL;
+    pool_slot_capacity = 0;
+    pool_count = 0;
+}
+
+/**
+ * @brief Finds the slot of a string in the hash table.
+ *
+ * This function probes the hash table from the hash value of the string until it finds the slot
+ * holding the string or an empty slot.
+ *
+ * @param str The string to be found.
+ * @return The position of the slot.
+ */
+static uint32_t findPoolSlot(const int8_t *str)
+{
+    uint32_t mask = pool_slot_capacity - 1;         /* Mask to wrap the slot position around the table */
+    uint32_t pos = hashStudentKey(str) & mask;      /* Position of the probed slot */
+
+    /* Probe until the string or an empty slot is found */
+    while ((pool_slots[pos] != 0) && (strcmp(&pool_data[pool_slots[pos] - 1], str) != 0))
+    {
+        pos = (pos + 1) & mask;
+    }
+    /* Return the position of the slot */
+    return pos;
+}
+
+/**
+ * @brief Doubles the capacity of the hash table.
+ */
+static void growPoolSlots(void)
+{
+    uint32_t *old_slots = pool_slots;               /* The slots of the old table */
+    uint32_t old_capacity = pool_slot_capacity;     /* The capacity of the old table */
+    uint32_t i = 0;                                 /* Index of each slot of the old table */
+
+    pool_slot_capacity = (old_capacity == 0) ? POOL_MIN_SLOTS : (old_capacity * 2);
+    pool_slots = (uint32_t *)calloc(pool_slot_capacity, sizeof(uint32_t));
+
+    /* Move every offset of the old table into the new table */
+    for (i = 0; i < old_capacity; i++)
+    {
+        if (old_slots[i] != 0)
+        {
+            pool_slots[findPoolSlot(&pool_data[old_slots[i] - 1])] = old_slots[i];
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    /* Free the old table */
+    free(old_slots);
+} /* EOF */
@@ -0,0 +1,130 @@
+/**
+ * @file string_pool.h
+ * @brief This file contains the function prototypes for the pool of interned strings.
+ *
+ * This file contains the function prototypes of a pool which stores variable-length strings back to back
+ * in one growing buffer. Each string is stored only once (interned) and is referenced by its offset
+ * in the buffer, so students having the same name share the same bytes.
+ * The pool only grows while the program runs, the strings which are no longer used are left out when
+ * the used strings are copied into a compact buffer, which is how the list is saved and loaded again.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>     /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>     /* For malloc(), realloc(), calloc(), free() functions */
+#include <string.h>     /* For strlen(), strcmp(), memcpy() functions */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define STRING_POOL_NONE    0xFFFFFFFFu     /* The offset returned when a string is not in the pool */
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct StringPoolCopy
+ * @brief This structure represents a compact copy of the strings of the pool which are used.
+ *
+ * The buffer of the copy stores every copied string once, back to back like the buffer of the pool.
+ * The pool must not be changed while a copy is being made.
+ */
+typedef struct StringPoolCopy
+{
+    int8_t *data;                   /* The buffer of the copied strings */
+    uint32_t size;                  /* The number of used bytes of the buffer */
+    uint32_t *copied_offsets;       /* For each slot of the pool, the offset plus one of its string in the copy, 0 if not copied */
+} StringPoolCopy_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Interns a string into the pool.
+ *
+ * This function returns the offset of the string in the pool.
+ * If the string is not in the pool yet, it is appended to the buffer of the pool first.
+ *
+ * @param str The string to be interned.
+ * @return The offset of the string in the pool.
+ */
+uint32_t internString(const int8_t *str);
+
+/**
+ * @brief Finds a string in the pool.
+ *
+ * This function returns the offset of the string if it has been interned, STRING_POOL_NONE otherwise.
+ * The pool is not modified.
+ *
+ * @param str The string to be found.
+ * @return The offset of the string in the pool, or STRING_POOL_NONE.
+ */
+uint32_t findPooledString(const int8_t *str);
+
+/**
+ * @brief Gets a string of the pool by its offset.
+ *
+ * The returned pointer is only valid until the next string is interned, because the buffer of the pool
+ * may be moved when it grows.
+ *
+ * @param offset The offset of the string in the pool.
+ * @return A pointer to the string.
+ */
+const int8_t *getPooledString(uint32_t offset);
+
+/**
+ * @brief Gets the number of bytes allocated by the pool.
+ *
+ * @return The number of bytes of the buffer and of the hash table of the pool.
+ */
+size_t getStringPoolBytes(void);
+
+/**
+ * @brief Starts a compact copy of the pool.
+ *
+ * This function allocates a buffer large enough for every string of the pool, so copying a string
+ * never allocates memory.
+ *
+ * @param copy The copy to be started, freed by freeStringPoolCopy.
+ * @return 1 if the copy is started, 0 if the memory cannot be allocated.
+ */
+int32_t beginStringPoolCopy(StringPoolCopy_t *copy);
+
+/**
+ * @brief Copies a string of the pool into a compact copy.
+ *
+ * This function appends the string to the buffer of the copy the first time it is copied and
+ * returns its offset in the copy.
+ *
+ * @param copy The copy started by beginStringPoolCopy.
+ * @param offset The offset of the string in the pool.
+ * @return The offset of the string in the buffer of the copy.
+ */
+uint32_t copyPooledString(StringPoolCopy_t *copy, uint32_t offset);
+
+/**
+ * @brief Frees a compact copy of the pool.
+ *
+ * @param copy The copy to be freed.
+ */
+void freeStringPoolCopy(StringPoolCopy_t *copy);
+
+/**
+ * @brief Releases every string of the pool.
+ *
+ * This function frees the buffer and the hash table of the pool. Every offset returned before becomes invalid.
+ */
+void releaseStringPool(void);
+
+#endif /* STRING_POOL_H */
@@ -0,0 +1,279 @@
+/**
+ * @file student_columns.c
+ * @brief This file contains the function definitions for the columnar storage of students.
+ *
+ * The file includes the function definitions of the columns of the list, which keep the average score
+ * and the pointer of every student in two arrays in the order of the linked list.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "student_columns.h"    /* Include header file of this function file */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Grows the columns to a capacity.
+ *
+ * This function reallocates both columns, the columns are freed and disabled if it fails.
+ *
+ * @param columns The columns.
+ * @param capacity The new number of rows the columns can hold.
+ * @return 1 if the columns are grown, 0 otherwise.
+ */
+static int32_t growStudentColumns(StudentColumns_t *columns, uint32_t capacity);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Enables or disables the columns.
+ *
+ * @param columns The columns.
+ * @param is_enabled 1 to enable the columns, 0 to disable them.
+ * @param first The first student of the list, NULL for an empty list.
+ * @param count The number of students of the list.
+ */
+void enableStudentColumns(StudentColumns_t *columns, int32_t is_enabled, Student_t *first, uint32_t count)
+{
+    freeStudentColumns(columns);
+    columns->is_enabled = (is_enabled != 0) ? 1 : 0;
+    buildStudentColumns(columns, first, count);
+}
+
+/**
+ * @brief Frees the rows of the columns.
+ *
+ * @param columns The columns to be freed.
+ */
+void freeStudentColumns(StudentColumns_t *columns)
+{
+    free(columns->scores);
+    free(columns->students);
+    columns->scores = NULL;
+    columns->students = NULL;
+    columns->count = 0;
+    columns->capacity = 0;
+}
+
+/**
+ * @brief Rebuilds the columns from a list.
+ *
+ * This function gathers the average score and the pointer of every student of the list in one traversal.
+ *
+ * @param columns The columns.
+ * @param first The first student of the list, NULL for an empty list.
+ * @param count The number of students of the list.
+ */
+void buildStudentColumns(StudentColumns_t *columns, Student_t *first, uint32_t count)
+{
+    Student_t *temp = first;    /* Temporary pointer to traverse the list */
+    uint32_t row = 0;           /* Position of each row */
+
+    columns->count = 0;
+    reserveStudentColumns(columns, count);
+    /* Only fill the columns if they are enabled and large enough */
+    if (columns->is_enabled)
+    {
+        for (row = 0; row < count; row++)
+        {
+            columns->scores[row] = temp->average_score;
+            columns->students[row] = temp;
+            temp = temp->next;
+        }
+        columns->count = count;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Rebuilds the columns from an array of students.
+ *
+ * @param columns The columns.
+ * @param students The students in the order of the list.
+ * @param count The number of students.
+ */
+void copyStudentColumns(StudentColumns_t *columns, Student_t *const *students, uint32_t count)
+{
+    uint32_t row = 0;           /* Position of each row */
+
+    columns->count = 0;
+    reserveStudentColumns(columns, count);
+    /* Only fill the columns if they are enabled and large enough */
+    if (columns->is_enabled)
+    {
+        for (row = 0; row < count; row++)
+        {
+            columns->scores[row] = students[row]->average_score;
+            columns->students[row] = students[row];
+        }
+        columns->count = count;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Grows the columns so they can hold a number of rows.
+ *
+ * @param columns The columns.
+ * @param count The number of rows the columns have to hold.
+ */
+void reserveStudentColumns(StudentColumns_t *columns, uint32_t count)
+{
+    uint32_t capacity = COLUMNS_MIN_CAPACITY;   /* The capacity needed to hold the rows */
+
+    /* Find the smallest power of two holding the rows */
+    while (capacity < count)
+    {
+        capacity *= 2;
+    }
+    /* Only grow enabled columns which are too small */
+    if (columns->is_enabled && (capacity > columns->capacity))
+    {
+        (void)growStudentColumns(columns, capacity);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Appends the row of a student to the columns.
+ *
+ * @param columns The columns.
+ * @param student The student linked at the end of the list.
+ */
+void appendStudentToColumns(StudentColumns_t *columns, Student_t *student)
+{
+    /* Double the capacity of full columns */
+    if (columns->is_enabled && (columns->count == columns->capacity))
+    {
+        (void)growStudentColumns(columns, (columns->capacity == 0) ? COLUMNS_MIN_CAPACITY : (columns->capacity * 2));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Append the row if the columns are still enabled */
+    if (columns->is_enabled)
+    {
+        columns->scores[columns->count] = student->average_score;
+        columns->students[columns->count] = student;
+        columns->count++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Removes rows from the columns.
+ *
+ * This function keeps a position to write the next kept row to, and moves each run of kept rows
+ * between two removed rows at once.
+ *
+ * @param columns The columns.
+ * @param rows The positions of the rows to be removed, in ascending order.
+ * @param num_rows The number of rows to be removed.
+ */
+void removeStudentColumnRows(StudentColumns_t *columns, const uint32_t *rows, uint32_t num_rows)
+{
+    uint32_t kept = 0;          /* The position the next kept row is moved to */
+    uint32_t start = 0;         /* The first row of the current run of kept rows */
+    uint32_t end = 0;           /* The row after the current run of kept rows */
+    uint32_t i = 0;             /* Index of each removed row */
+
+    if (columns->is_enabled && (num_rows > 0))
+    {
+        kept = rows[0];
+        for (i = 0; i < num_rows; i++)
+        {
+            /* Move the run of kept rows after the removed row */
+            start = rows[i] + 1;
+            end = (i < (num_rows - 1)) ? rows[i + 1] : columns->count;
+            memmove(&columns->scores[kept], &columns->scores[start], (end - start) * sizeof(float));
+            memmove(&columns->students[kept], &columns->students[start], (end - start) * sizeof(Student_t *));
+            kept += end - start;
+        }
+        columns->count = kept;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Counts the rows whose average score is in a range.
+ *
+ * @param columns The columns.
+ * @param min_score The lowest average score of the range.
+ * @param max_score The highest average score of the range.
+ * @return The number of rows whose average score is between min_score and max_score.
+ */
+uint32_t countStudentColumnScores(const StudentColumns_t *columns, float min_score, float max_score)
+{
+    const float *scores = columns->scores;  /* The score column */
+    uint32_t num_found = 0;                 /* The number of rows in the range */
+    uint32_t row = 0;                       /* Position of each row */
+
+    /* Add the result of the comparisons instead of branching on them */
+    for (row = 0; row < columns->count; row++)
+    {
+        num_found += (uint32_t)((scores[row] >= min_score) & (scores[row] <= max_score));
+    }
+    /* Return the number of rows in the range */
+    return num_found;
+}
+
+/**
+ * @brief Grows the columns to a capacity.
+ *
+ * @param columns The columns.
+ * @param capacity The new number of rows the columns can hold.
+ * @return 1 if the columns are grown, 0 otherwise.
+ */
+static int32_t growStudentColumns(StudentColumns_t *columns, uint32_t capacity)
+{
+    float *scores = (float *)realloc(columns->scores, (size_t)capacity * sizeof(float));     /* The grown score column */
+    Student_t **students = NULL;        /* The grown student column */
+    int32_t is_grown = 0;               /* Initialize is_grown to 0 */
+
+    /* Keep the score column even if the student column cannot be grown, so it is freed below */
+    if (scores != NULL)
+    {
+        columns->scores = scores;
+        students = (Student_t **)realloc(columns->students, (size_t)capacity * sizeof(Student_t *));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if (students != NULL)
+    {
+        columns->students = students;
+        columns->capacity = capacity;
+        is_grown = 1;
+    }
+    else
+    {
+        /* Columns which cannot follow the list are dropped */
+        freeStudentColumns(columns);
+        columns->is_enabled = 0;
+    }
+    /* Return the value of is_grown */
+    return is_grown;
+} /* EOF */
@@ -0,0 +1,143 @@
+/**
+ * @file student_columns.h
+ * @brief This file contains the function prototypes and data structures for the columnar storage of students.
+ *
+ * This file contains the function prototypes and data structures of the columnar storage of the list.
+ * When it is enabled, the average scores of the students are also kept in a contiguous column in the order
+ * of the linked list, next to a column of pointers to the students, so the operations which only need
+ * the scores read 4 bytes per student instead of a whole node.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For realloc(), free() functions */
+#include <string.h>             /* For memmove() function */
+#include "manage_students.h"    /* Include header file for the Student_t structure */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef STUDENT_COLUMNS_H
+#define STUDENT_COLUMNS_H
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define COLUMNS_MIN_CAPACITY    1024u       /* The number of rows of the columns when they are first allocated */
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct StudentColumns
+ * @brief This structure represents the columns of the list of students.
+ *
+ * Row i of every column describes the i-th student of the linked list. Every function does nothing
+ * while the columns are disabled, and the columns disable themselves if their memory cannot be allocated,
+ * so the list never relies on columns which are out of date.
+ */
+typedef struct StudentColumns
+{
+    float *scores;                  /* The average score of each row */
+    Student_t **students;           /* The student of each row */
+    uint32_t count;                 /* The number of rows */
+    uint32_t capacity;              /* The number of rows the columns can hold */
+    int32_t is_enabled;             /* 1 if the columns are kept in sync with the list, 0 otherwise */
+} StudentColumns_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Enables or disables the columns.
+ *
+ * This function builds the columns from a list when they are enabled, and frees them when they are disabled.
+ *
+ * @param columns The columns.
+ * @param is_enabled 1 to enable the columns, 0 to disable them.
+ * @param first The first student of the list, NULL for an empty list.
+ * @param count The number of students of the list.
+ */
+void enableStudentColumns(StudentColumns_t *columns, int32_t is_enabled, Student_t *first, uint32_t count);
+
+/**
+ * @brief Frees the rows of the columns.
+ *
+ * This function frees the memory of the columns and makes them empty, they stay enabled or disabled.
+ *
+ * @param columns The columns to be freed.
+ */
+void freeStudentColumns(StudentColumns_t *columns);
+
+/**
+ * @brief Rebuilds the columns from a list.
+ *
+ * This function replaces every row of the columns by the students of the list in its order,
+ * it is called after the list is relinked in another order.
+ *
+ * @param columns The columns.
+ * @param first The first student of the list, NULL for an empty list.
+ * @param count The number of students of the list.
+ */
+void buildStudentColumns(StudentColumns_t *columns, Student_t *first, uint32_t count);
+
+/**
+ * @brief Rebuilds the columns from an array of students.
+ *
+ * This function is like buildStudentColumns, but reads the students from an array in the order of the list,
+ * so the students are loaded independently of each other instead of one after the other.
+ *
+ * @param columns The columns.
+ * @param students The students in the order of the list.
+ * @param count The number of students.
+ */
+void copyStudentColumns(StudentColumns_t *columns, Student_t *const *students, uint32_t count);
+
+/**
+ * @brief Grows the columns so they can hold a number of rows.
+ *
+ * @param columns The columns.
+ * @param count The number of rows the columns have to hold.
+ */
+void reserveStudentColumns(StudentColumns_t *columns, uint32_t count);
+
+/**
+ * @brief Appends the row of a student to the columns.
+ *
+ * The columns double their capacity when they are full.
+ *
+ * @param columns The columns.
+ * @param student The student linked at the end of the list.
+ */
+void appendStudentToColumns(StudentColumns_t *columns, Student_t *student);
+
+/**
+ * @brief Removes rows from the columns.
+ *
+ * This function moves the rows which are kept over the removed rows in one pass,
+ * so the columns stay in the order of the list.
+ *
+ * @param columns The columns.
+ * @param rows The positions of the rows to be removed, in ascending order.
+ * @param num_rows The number of rows to be removed.
+ */
+void removeStudentColumnRows(StudentColumns_t *columns, const uint32_t *rows, uint32_t num_rows);
+
+/**
+ * @brief Counts the rows whose average score is in a range.
+ *
+ * This function scans the score column only, in a loop without branches which the compiler can vectorize.
+ *
+ * @param columns The columns.
+ * @param min_score The lowest average score of the range.
+ * @param max_score The highest average score of the range.
+ * @return The number of rows whose average score is between min_score and max_score.
+ */
+uint32_t countStudentColumnScores(const StudentColumns_t *columns, float min_score, float max_score);
+
+#endif /* STUDENT_COLUMNS_H */
@@ -0,0 +1,320 @@
+/**
+ * @file student_index.c
+ * @brief This file contains the function definitions for the hash index of students.
+ *
+ * The file includes the function definitions of an open-addressing hash table with linear probing
+ * which indexes the students of the linked list by a string key.
+ * Removed students leave a tombstone in their slot, tombstones are dropped when the table is rebuilt.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "student_index.h"      /* Include header file of this function file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define INDEX_MIN_CAPACITY      64u                     /* The capacity of a newly allocated hash table */
+#define INDEX_TOMBSTONE         (&index_tombstone)      /* The marker of a slot whose student has been removed */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static Student_t index_tombstone;   /* This variable is only used for its address as the tombstone marker. */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Rebuilds the hash table of an index with a new capacity.
+ *
+ * This function allocates a new hash table, moves every student of the old table into it and
+ * frees the old table. Tombstones are not moved.
+ *
+ * @param index The index to be rebuilt.
+ * @param capacity The capacity of the new hash table, it must be a power of two.
+ */
+static void rebuildStudentIndex(StudentIndex_t *index, uint32_t capacity);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Computes the hash value of a key.
+ *
+ * This function computes the 32-bit FNV-1a hash value of a null-terminated key.
+ *
+ * @param key The key to be hashed.
+ * @return The hash value of the key.
+ */
+uint32_t hashStudentKey(const int8_t *key)
+{
+    uint32_t hash = 2166136261u;    /* Initialize hash to the FNV offset basis */
+
+    /* Mix every character of the key into the hash */
+    while (*key != '\0')
+    {
+        hash ^= (uint8_t)*key;
+        hash *= 16777619u;
+        key++;
+    }
+    /* Return the hash value */
+    return hash;
+}
+
+/**
+ * @brief Initializes an empty index.
+ *
+ * This function initializes an empty index which uses the given functions to get the key of a student
+ * and its hash value. The hash table is allocated on the first insertion.
+ *
+ * @param index The index to be initialized.
+ * @param get_key The function which returns the key of a student.
+ * @param get_hash The function which returns the hash value of the key of a student, equal to hashStudentKey of the key.
+ */
+void initStudentIndex(StudentIndex_t *index, StudentKeyGetter_t get_key, StudentHashGetter_t get_hash)
+{
+    index->slots = NULL;
+    index->capacity = 0;
+    index->used = 0;
+    index->count = 0;
+    index->get_key = get_key;
+    index->get_hash = get_hash;
+}
+
+/**
+ * @brief Frees the hash table of an index.
+ *
+ * This function frees the hash table of an index and makes the index empty.
+ * The students themselves are not freed.
+ *
+ * @param index The index to be freed.
+ */
+void freeStudentIndex(StudentIndex_t *index)
+{
+    free(index->slots);
+    initStudentIndex(index, index->get_key, index->get_hash);
+}
+
+/**
+ * @brief Reserves room in an index for a number of students.
+ *
+ * This function grows the hash table so that the given number of students can be inserted
+ * without rebuilding the table again.
+ *
+ * @param index The index to be presized.
+ * @param count The number of students which the index must be able to hold.
+ */
+void reserveStudentIndex(StudentIndex_t *index, uint32_t count)
+{
+    uint32_t capacity = INDEX_MIN_CAPACITY;     /* The capacity needed to hold the students */
+
+    /* Find the smallest capacity keeping the table at most 40% full */
+    while ((uint64_t)capacity * 4 < (uint64_t)count * 10)
+    {
+        capacity *= 2;
+    }
+    /* Only rebuild the table if it has to grow */
+    if (capacity > index->capacity)
+    {
+        rebuildStudentIndex(index, capacity);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Inserts a student into an index.
+ *
+ * This function inserts a student into an index.
+ * The hash table is grown when its load factor becomes too high.
+ *
+ * @param index The index which the student is inserted into.
+ * @param student The student to be inserted.
+ */
+void insertStudentToIndex(StudentIndex_t *index, Student_t *student)
+{
+    uint32_t mask = 0;      /* Mask to wrap the slot position around the table */
+    uint32_t pos = 0;       /* Position of the probed slot */
+
+    /* If the table would be more than 70% full, rebuild it */
+    if ((uint64_t)(index->used + 1) * 10 > (uint64_t)index->capacity * 7)
+    {
+        /* Double the capacity if the students fill the table, otherwise only drop the tombstones */
+        if (index->capacity == 0)
+        {
+            rebuildStudentIndex(index, INDEX_MIN_CAPACITY);
+        }
+        else if ((uint64_t)(index->count + 1) * 10 > (uint64_t)index->capacity * 4)
+        {
+            rebuildStudentIndex(index, index->capacity * 2);
+        }
+        else
+        {
+            rebuildStudentIndex(index, index->capacity);
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    mask = index->capacity - 1;
+    pos = index->get_hash(student) & mask;
+
+    /* Probe until an empty slot or a tombstone is found */
+    while ((index->slots[pos] != NULL) && (index->slots[pos] != INDEX_TOMBSTONE))
+    {
+        pos = (pos + 1) & mask;
+    }
+    /* Only an empty slot increases the number of used slots */
+    if (index->slots[pos] == NULL)
+    {
+        index->used++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    index->slots[pos] = student;
+    index->count++;
+}
+
+/**
+ * @brief Finds a student by key in an index.
+ *
+ * This function finds the student whose key is equal to the input key.
+ * It returns NULL if there is no such student.
+ *
+ * @param index The index to be searched.
+ * @param key The key to be found.
+ * @return A pointer to the student if found, NULL otherwise.
+ */
+Student_t *findStudentInIndex(const StudentIndex_t *index, const int8_t *key)
+{
+    Student_t *found = NULL;    /* Initialize found to NULL */
+    uint32_t hash = 0;          /* The hash value of the input key */
+    uint32_t mask = 0;          /* Mask to wrap the slot position around the table */
+    uint32_t pos = 0;           /* Position of the probed slot */
+
+    /* If the table is allocated */
+    if (index->capacity != 0)
+    {
+        mask = index->capacity - 1;
+        hash = hashStudentKey(key);
+        pos = hash & mask;
+
+        /* Probe until the key or an empty slot is found */
+        while ((found == NULL) && (index->slots[pos] != NULL))
+        {
+            /* If the slot holds a student whose key is equal to the input key, the hash values are compared first */
+            if ((index->slots[pos] != INDEX_TOMBSTONE) && (index->get_hash(index->slots[pos]) == hash) &&
+                (strcmp(index->get_key(index->slots[pos]), key) == 0))
+            {
+                found = index->slots[pos];
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            pos = (pos + 1) & mask;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return the found student */
+    return found;
+}
+
+/**
+ * @brief Removes a student from an index.
+ *
+ * This function removes the given student from an index by replacing its slot by a tombstone.
+ * Nothing happens if the student is not in the index.
+ *
+ * @param index The index which the student is removed from.
+ * @param student The student to be removed.
+ */
+void removeStudentFromIndex(StudentIndex_t *index, Student_t *student)
+{
+    uint32_t mask = 0;      /* Mask to wrap the slot position around the table */
+    uint32_t pos = 0;       /* Position of the probed slot */
+
+    /* If the table is allocated */
+    if (index->capacity != 0)
+    {
+        mask = index->capacity - 1;
+        pos = index->get_hash(student) & mask;
+
+        /* Probe until the student or an empty slot is found */
+        while ((index->slots[pos] != NULL) && (index->slots[pos] != student))
+        {
+            pos = (pos + 1) & mask;
+        }
+        /* If the student is found, replace it by a tombstone */
+        if (index->slots[pos] == student)
+        {
+            index->slots[pos] = INDEX_TOMBSTONE;
+            index->count--;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Rebuilds the hash table of an index with a new capacity.
+ *
+ * This function allocates a new hash table, moves every student of the old table into it and
+ * frees the old table. Tombstones are not moved.
+ *
+ * @param index The index to be rebuilt.
+ * @param capacity The capacity of the new hash table, it must be a power of two.
+ */
+static void rebuildStudentIndex(StudentIndex_t *index, uint32_t capacity)
+{
+    Student_t **old_slots = index->slots;       /* The slots of the old table */
+    uint32_t old_capacity = index->capacity;    /* The capacity of the old table */
+    uint32_t mask = capacity - 1;               /* Mask to wrap the slot position around the new table */
+    uint32_t pos = 0;                           /* Position of the probed slot */
+    uint32_t i = 0;                             /* Index of each slot of the old table */
+
+    index->slots = (Student_t **)calloc(capacity, sizeof(Student_t *));
+    index->capacity = capacity;
+    index->used = index->count;
+
+    /* Move every student of the old table into the new table */
+    for (i = 0; i < old_capacity; i++)
+    {
+        if ((old_slots[i] != NULL) && (old_slots[i] != INDEX_TOMBSTONE))
+        {
+            pos = index->get_hash(old_slots[i]) & mask;
+            /* Probe until an empty slot is found */
+            while (index->slots[pos] != NULL)
+            {
+                pos = (pos + 1) & mask;
+            }
+            index->slots[pos] = old_slots[i];
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    /* Free the old table */
+    free(old_slots);
+} /* EOF */
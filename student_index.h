@@ -0,0 +1,142 @@
+/**
+ * @file student_index.h
+ * @brief This file contains the function prototypes and data structures for the hash index of students.
+ *
+ * This file contains the function prototypes and data structures of an open-addressing hash table
+ * which indexes the students of the linked list by a string key (the ID or the account).
+ * It lets the program check the uniqueness of a key and find a student in constant expected time
+ * instead of traversing the whole linked list.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For malloc(), calloc(), free() functions */
+#include <string.h>             /* For strcmp() function */
+#include "manage_students.h"    /* Include header file for the Student_t structure */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef STUDENT_INDEX_H
+#define STUDENT_INDEX_H
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @brief Pointer to a function which returns the key of a student used by an index.
+ */
+typedef const int8_t *(*StudentKeyGetter_t)(const Student_t *student);
+
+/**
+ * @brief Pointer to a function which returns the hash value of the key of a student, stored in the student.
+ */
+typedef uint32_t (*StudentHashGetter_t)(const Student_t *student);
+
+/**
+ * @struct StudentIndex
+ * @brief This structure represents a hash index of students.
+ *
+ * This structure represents an open-addressing hash table with linear probing.
+ * Each slot stores a pointer to a student of the linked list, NULL for an empty slot or
+ * a tombstone for a slot whose student has been removed.
+ * The capacity of the table is always a power of two.
+ * The hash value of the key of a student is read from the student, so the keys are not hashed again
+ * when the table grows, and a probed student is only compared with strcmp if its hash value matches.
+ */
+typedef struct StudentIndex
+{
+    Student_t **slots;              /* The slots of the hash table */
+    uint32_t capacity;              /* The number of slots of the hash table */
+    uint32_t used;                  /* The number of slots which are not empty (students and tombstones) */
+    uint32_t count;                 /* The number of students in the hash table */
+    StudentKeyGetter_t get_key;     /* The function which returns the key of a student */
+    StudentHashGetter_t get_hash;   /* The function which returns the hash value of the key of a student */
+} StudentIndex_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Computes the hash value of a key.
+ *
+ * This function computes the 32-bit FNV-1a hash value of a null-terminated key.
+ *
+ * @param key The key to be hashed.
+ * @return The hash value of the key.
+ */
+uint32_t hashStudentKey(const int8_t *key);
+
+/**
+ * @brief Initializes an empty index.
+ *
+ * This function initializes an empty index which uses the given functions to get the key of a student
+ * and its hash value. The hash table is allocated on the first insertion.
+ *
+ * @param index The index to be initialized.
+ * @param get_key The function which returns the key of a student.
+ * @param get_hash The function which returns the hash value of the key of a student, equal to hashStudentKey of the key.
+ */
+void initStudentIndex(StudentIndex_t *index, StudentKeyGetter_t get_key, StudentHashGetter_t get_hash);
+
+/**
+ * @brief Frees the hash table of an index.
+ *
+ * This function frees the hash table of an index and makes the index empty.
+ * The students themselves are not freed.
+ *
+ * @param index The index to be freed.
+ */
+void freeStudentIndex(StudentIndex_t *index);
+
+/**
+ * @brief Reserves room in an index for a number of students.
+ *
+ * This function grows the hash table so that the given number of students can be inserted
+ * without rebuilding the table again.
+ *
+ * @param index The index to be presized.
+ * @param count The number of students which the index must be able to hold.
+ */
+void reserveStudentIndex(StudentIndex_t *index, uint32_t count);
+
+/**
+ * @brief Inserts a student into an index.
+ *
+ * This function inserts a student into an index.
+ * The hash table is grown when its load factor becomes too high.
+ *
+ * @param index The index which the student is inserted into.
+ * @param student The student to be inserted.
+ */
+void insertStudentToIndex(StudentIndex_t *index, Student_t *student);
+
+/**
+ * @brief Finds a student by key in an index.
+ *
+ * This function finds the student whose key is equal to the input key.
+ * It returns NULL if there is no such student.
+ *
+ * @param index The index to be searched.
+ * @param key The key to be found.
+ * @return A pointer to the student if found, NULL otherwise.
+ */
+Student_t *findStudentInIndex(const StudentIndex_t *index, const int8_t *key);
+
+/**
+ * @brief Removes a student from an index.
+ *
+ * This function removes the given student from an index by replacing its slot by a tombstone.
+ * Nothing happens if the student is not in the index.
+ *
+ * @param index The index which the student is removed from.
+ * @param student The student to be removed.
+ */
+void removeStudentFromIndex(StudentIndex_t *index, Student_t *student);
+
+#endif /* STUDENT_INDEX_H */
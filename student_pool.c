@@ -0,0 +1,185 @@
+/**
+ * @file student_pool.c
+ * @brief This file contains the function definitions for the slab allocator of students.
+ *
+ * The file includes the function definitions of a slab allocator which carves the nodes of the linked list
+ * from large contiguous chunks of memory.
+ * Freed nodes are threaded into a free list through their next pointer.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "student_pool.h"       /* Include header file of this function file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define POOL_MIN_CHUNK_NODES    256         /* The number of nodes of the first chunk */
+#define POOL_MAX_CHUNK_NODES    65536       /* The maximum number of nodes of a chunk */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static StudentChunk_t *chunks = NULL;       /* The list of chunks, the current chunk is the first one */
+static Student_t *free_nodes = NULL;        /* The list of freed nodes */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Allocates a node for a student.
+ *
+ * This function takes a node from the free list if it is not empty.
+ * Otherwise it carves a node from the current chunk, a new chunk is allocated when the current chunk is full.
+ * Each new chunk is twice as large as the previous one, up to a maximum size.
+ *
+ * @return A pointer to the allocated node.
+ */
+Student_t *allocStudentNode(void)
+{
+    Student_t *node = NULL;             /* The allocated node */
+    StudentChunk_t *chunk = NULL;       /* The newly allocated chunk */
+    int32_t capacity = 0;               /* The number of nodes of the new chunk */
+
+    /* If there is a freed node, reuse it */
+    if (free_nodes != NULL)
+    {
+        node = free_nodes;
+        free_nodes = free_nodes->next;
+    }
+    else
+    {
+        /* If there is no chunk or the current chunk is full, allocate a new chunk */
+        if ((chunks == NULL) || (chunks->used == chunks->capacity))
+        {
+            capacity = (chunks == NULL) ? POOL_MIN_CHUNK_NODES : (chunks->capacity * 2);
+            if (capacity > POOL_MAX_CHUNK_NODES)
+            {
+                capacity = POOL_MAX_CHUNK_NODES;
+            }
+            /* The first chunk may be a small block of allocStudentNodes */
+            else if (capacity < POOL_MIN_CHUNK_NODES)
+            {
+                capacity = POOL_MIN_CHUNK_NODES;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            chunk = (StudentChunk_t *)malloc(sizeof(StudentChunk_t) + (size_t)capacity * sizeof(Student_t));
+            chunk->capacity = capacity;
+            chunk->used = 0;
+            /* The new chunk becomes the current chunk */
+            chunk->next = chunks;
+            chunks = chunk;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        /* Carve the next node of the current chunk */
+        node = &chunks->nodes[chunks->used];
+        chunks->used++;
+    }
+    /* Return a pointer to the allocated node */
+    return node;
+}
+
+/**
+ * @brief Allocates a contiguous block of nodes.
+ *
+ * This function allocates a new chunk holding exactly the given number of nodes and returns its first node,
+ * so a whole batch of students is stored side by side. The current chunk keeps its free nodes.
+ * Nodes of the block which are not used can be given back with freeStudentNode.
+ *
+ * @param count The number of nodes of the block, at least 1.
+ * @return A pointer to the first node of the block, NULL if the memory of the block cannot be allocated.
+ */
+Student_t *allocStudentNodes(int32_t count)
+{
+    StudentChunk_t *chunk = (StudentChunk_t *)malloc(sizeof(StudentChunk_t) + (size_t)count * sizeof(Student_t));  /* The chunk of the block */
+    Student_t *block = NULL;            /* The first node of the block */
+
+    /* If the chunk is allocated, link it to the chunks */
+    if (chunk != NULL)
+    {
+        chunk->capacity = count;
+        chunk->used = count;
+        /* Keep the current chunk first so its free nodes are still carved */
+        if (chunks != NULL)
+        {
+            chunk->next = chunks->next;
+            chunks->next = chunk;
+        }
+        else
+        {
+            chunk->next = NULL;
+            chunks = chunk;
+        }
+        block = &chunk->nodes[0];
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return a pointer to the first node of the block */
+    return block;
+}
+
+/**
+ * @brief Frees a node of a student.
+ *
+ * This function pushes the node to the free list so it can be reused by the next allocation.
+ *
+ * @param student The node to be freed.
+ */
+void freeStudentNode(Student_t *student)
+{
+    student->next = free_nodes;
+    free_nodes = student;
+}
+
+/**
+ * @brief Gets the number of bytes allocated by the slab allocator.
+ *
+ * @return The number of bytes of every chunk.
+ */
+size_t getStudentPoolBytes(void)
+{
+    size_t bytes = 0;                   /* Initialize bytes to 0 */
+    StudentChunk_t *chunk = chunks;     /* Temporary pointer to traverse the chunks */
+
+    /* Add the size of every chunk */
+    while (chunk != NULL)
+    {
+        bytes += sizeof(StudentChunk_t) + (size_t)chunk->capacity * sizeof(Student_t);
+        chunk = chunk->next;
+    }
+    /* Return the number of bytes */
+    return bytes;
+}
+
+/**
+ * @brief Releases every node of the slab allocator.
+ *
+ * This function frees every chunk of the slab allocator and empties the free list.
+ * Every node allocated before must not be used anymore.
+ */
+void releaseStudentPool(void)
+{
+    StudentChunk_t *chunk = NULL;       /* The chunk to be freed */
+
+    /* Free every chunk */
+    while (chunks != NULL)
+    {
+        chunk = chunks;
+        chunks = chunks->next;
+        free(chunk);
+    }
+    /* Empty the free list */
+    free_nodes = NULL;
+} /* EOF */
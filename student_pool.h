@@ -0,0 +1,95 @@
+/**
+ * @file student_pool.h
+ * @brief This file contains the function prototypes and data structures for the slab allocator of students.
+ *
+ * This file contains the function prototypes and data structures of a slab allocator which carves the
+ * nodes of the linked list from large contiguous chunks of memory.
+ * Freed nodes are kept in a free list to be reused, and every chunk is released at once when the
+ * list of students is cleared.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For malloc(), free() functions */
+#include "manage_students.h"    /* Include header file for the Student_t structure */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef STUDENT_POOL_H
+#define STUDENT_POOL_H
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct StudentChunk
+ * @brief This structure represents a chunk of nodes of the slab allocator.
+ *
+ * This structure represents a contiguous chunk of memory holding a fixed number of nodes.
+ * The chunks are linked together so they can be released at once.
+ */
+typedef struct StudentChunk
+{
+    struct StudentChunk *next;  /* Pointer to the next chunk */
+    int32_t capacity;           /* The number of nodes of the chunk */
+    int32_t used;               /* The number of nodes which have been carved from the chunk */
+    Student_t nodes[];          /* The nodes of the chunk */
+} StudentChunk_t;
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Allocates a node for a student.
+ *
+ * This function takes a node from the free list if it is not empty.
+ * Otherwise it carves a node from the current chunk, a new chunk is allocated when the current chunk is full.
+ * Each new chunk is twice as large as the previous one, up to a maximum size.
+ *
+ * @return A pointer to the allocated node.
+ */
+Student_t *allocStudentNode(void);
+
+/**
+ * @brief Allocates a contiguous block of nodes.
+ *
+ * This function allocates a new chunk holding exactly the given number of nodes and returns its first node,
+ * so a whole batch of students is stored side by side. The current chunk keeps its free nodes.
+ * Nodes of the block which are not used can be given back with freeStudentNode.
+ *
+ * @param count The number of nodes of the block, at least 1.
+ * @return A pointer to the first node of the block, NULL if the memory of the block cannot be allocated.
+ */
+Student_t *allocStudentNodes(int32_t count);
+
+/**
+ * @brief Frees a node of a student.
+ *
+ * This function pushes the node to the free list so it can be reused by the next allocation.
+ *
+ * @param student The node to be freed.
+ */
+void freeStudentNode(Student_t *student);
+
+/**
+ * @brief Gets the number of bytes allocated by the slab allocator.
+ *
+ * @return The number of bytes of every chunk.
+ */
+size_t getStudentPoolBytes(void);
+
+/**
+ * @brief Releases every node of the slab allocator.
+ *
+ * This function frees every chunk of the slab allocator and empties the free list.
+ * Every node allocated before must not be used anymore.
+ */
+void releaseStudentPool(void);
+
+#endif /* STUDENT_POOL_H */
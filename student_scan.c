@@ -0,0 +1,563 @@
+/**
+ * @file student_scan.c
+ * @brief This file contains the function definitions for scanning the students of the list.
+ *
+ * The file includes the function definitions of the scans of a chain or of an array of students.
+ * The parallel scan runs its parts on a pool of worker threads, POSIX threads or Windows threads when it is
+ * built on Windows, which are started by the first scans needing them and then wait for the next scan.
+ * The calling thread takes parts like the workers do. The first part is scanned straight into the result set,
+ * every other part into a result set of its own which is appended afterwards.
+ * The pool runs the parts of one scan at a time, a scan started while it is busy runs its parts
+ * on the calling thread.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include "student_scan.h"       /* Include header file of this function file */
+#ifdef _WIN32
+#include <windows.h>            /* For CreateThread(), SleepConditionVariableSRW() functions */
+#else
+#include <pthread.h>            /* For pthread_create(), pthread_cond_wait() functions */
+#endif
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @struct ScanTask
+ * @brief This structure represents the work of one thread of the parallel scan.
+ */
+typedef struct ScanTask
+{
+    Student_t *const *students;     /* The students of the part */
+    uint32_t count;                 /* The number of students of the part */
+    StudentMatch_t match;           /* The function which checks each student */
+    const Student_t *probe;         /* The student which the students are matched with */
+    StudentResultSet_t *result;     /* The result set receiving the matching students of the part */
+    int32_t is_complete;            /* 1 if every matching student of the part is appended */
+} ScanTask_t;
+
+#ifdef _WIN32
+typedef CONDITION_VARIABLE ScanCondition_t;     /* A condition which the threads of the pool wait for */
+#else
+typedef pthread_cond_t ScanCondition_t;         /* A condition which the threads of the pool wait for */
+#endif
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief Appends a student to a result set.
+ *
+ * @param result The result set.
+ * @param student The student to be appended.
+ * @return 1 if the student is appended, 0 if the memory of the result set cannot be allocated.
+ */
+static int32_t appendToResultSet(StudentResultSet_t *result, Student_t *student);
+
+/**
+ * @brief Scans the part of a task.
+ *
+ * @param task The task to be run.
+ */
+static void runScanTask(ScanTask_t *task);
+
+/**
+ * @brief Runs the tasks of the pool which are not taken yet.
+ *
+ * @note The calling thread holds the lock of the pool.
+ */
+static void runPoolTasks(void);
+
+/**
+ * @brief Starts the worker threads of the pool which are missing.
+ *
+ * @param num_threads The number of worker threads needed.
+ * @note The calling thread holds the lock of the pool.
+ */
+static void startScanWorkers(uint32_t num_threads);
+
+/**
+ * @brief Takes the lock of the pool.
+ */
+static void lockScanPool(void);
+
+/**
+ * @brief Releases the lock of the pool.
+ */
+static void unlockScanPool(void);
+
+/**
+ * @brief Releases the lock of the pool until a condition is signaled, then takes it again.
+ *
+ * @param condition The condition to be waited for.
+ */
+static void waitScanCondition(ScanCondition_t *condition);
+
+/**
+ * @brief Wakes every thread waiting for a condition.
+ *
+ * @param condition The condition to be signaled.
+ */
+static void signalScanCondition(ScanCondition_t *condition);
+
+#ifdef _WIN32
+/**
+ * @brief Runs the tasks of the pool on a worker thread.
+ *
+ * @param arg Not used.
+ * @return Never returns.
+ */
+static DWORD WINAPI scanWorkerMain(LPVOID arg);
+#else
+/**
+ * @brief Runs the tasks of the pool on a worker thread.
+ *
+ * @param arg Not used.
+ * @return Never returns.
+ */
+static void *scanWorkerMain(void *arg);
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+#ifdef _WIN32
+static SRWLOCK pool_lock = SRWLOCK_INIT;                        /* The lock of the pool */
+static ScanCondition_t pool_work = CONDITION_VARIABLE_INIT;     /* Signaled when the pool has new tasks */
+static ScanCondition_t pool_done = CONDITION_VARIABLE_INIT;     /* Signaled when every task of the pool is done */
+#else
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;   /* The lock of the pool */
+static ScanCondition_t pool_work = PTHREAD_COND_INITIALIZER;    /* Signaled when the pool has new tasks */
+static ScanCondition_t pool_done = PTHREAD_COND_INITIALIZER;    /* Signaled when every task of the pool is done */
+#endif
+static uint32_t num_workers = 0;            /* The number of worker threads of the pool */
+static int32_t is_pool_busy = 0;            /* 1 while a scan runs its parts on the pool */
+static ScanTask_t *pool_tasks = NULL;       /* The tasks of the scan running on the pool */
+static uint32_t num_pool_tasks = 0;         /* The number of tasks of the scan running on the pool */
+static uint32_t next_pool_task = 0;         /* The position of the first task which is not taken yet */
+static uint32_t num_running_tasks = 0;      /* The number of tasks which are not done yet */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/**
+ * @brief Scans a chain of students on the calling thread.
+ *
+ * This function follows the next pointers of the chain and appends every matching student, it stops
+ * if the memory of the result set cannot be allocated.
+ *
+ * @param first The first student of the chain, NULL for an empty chain.
+ * @param match The function which checks each student.
+ * @param probe The student which the students are matched with.
+ * @param result The result set, the matching students are appended to it.
+ * @return 1 if every matching student is appended, 0 if the memory of the result set cannot be allocated.
+ */
+int32_t scanStudentChain(Student_t *first, StudentMatch_t match, const Student_t *probe, StudentResultSet_t *result)
+{
+    Student_t *student = first;         /* Each student of the chain */
+    int32_t is_complete = 1;            /* 1 while every matching student is appended */
+
+    while ((student != NULL) && is_complete)
+    {
+        if (match(student, probe))
+        {
+            is_complete = appendToResultSet(result, student);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        student = student->next;
+    }
+    /* Return 1 if every matching student is appended */
+    return is_complete;
+}
+
+/**
+ * @brief Scans an array of students on several threads.
+ *
+ * This function cuts the array into one part per thread, each part having at least STUDENT_SCAN_MIN_PART
+ * students. If the pool is free, it is given the parts, the missing worker threads are started and the calling
+ * thread scans parts too until every part is taken, then waits for the parts still scanned by the workers.
+ * If the pool is busy, or the array has a single part, every part is scanned on the calling thread.
+ * Once every part is done, the result sets of the parts are appended to the result set in the order of the parts.
+ *
+ * @param students The students in the order of the list.
+ * @param count The number of students.
+ * @param match The function which checks each student.
+ * @param probe The student which the students are matched with.
+ * @param num_threads The number of threads, between 1 and STUDENT_SCAN_MAX_THREADS.
+ * @param result The result set, the matching students are appended to it.
+ * @return 1 if every matching student is appended, 0 if the memory of the result set cannot be allocated.
+ */
+int32_t scanStudentArray(Student_t *const *students, uint32_t count, StudentMatch_t match, const Student_t *probe,
+                         int32_t num_threads, StudentResultSet_t *result)
+{
+    ScanTask_t tasks[STUDENT_SCAN_MAX_THREADS];             /* The task of each part */
+    StudentResultSet_t parts[STUDENT_SCAN_MAX_THREADS];     /* The result set of each part but the first one */
+    uint32_t num_parts = count / STUDENT_SCAN_MIN_PART;     /* The number of parts */
+    uint32_t total = 0;                 /* The number of students of the result set after the parts are appended */
+    Student_t **grown = NULL;           /* The array of the result set grown to receive the parts */
+    int32_t is_pooled = 0;              /* 1 if the parts are run on the pool */
+    int32_t is_complete = 1;            /* 1 while every matching student is appended */
+    uint32_t i = 0;                     /* Position of each part */
+
+    /* One part per thread, but no part smaller than STUDENT_SCAN_MIN_PART students */
+    num_parts = (num_parts > (uint32_t)num_threads) ? (uint32_t)num_threads : num_parts;
+    num_parts = (num_parts == 0) ? 1 : num_parts;
+
+    for (i = 0; i < num_parts; i++)
+    {
+        tasks[i].students = &students[((uint64_t)count * i) / num_parts];
+        tasks[i].count = (uint32_t)(((uint64_t)count * (i + 1)) / num_parts - ((uint64_t)count * i) / num_parts);
+        tasks[i].match = match;
+        tasks[i].probe = probe;
+        tasks[i].result = (i == 0) ? result : &parts[i];
+        tasks[i].is_complete = 1;
+        parts[i].students = NULL;
+        parts[i].count = 0;
+        parts[i].capacity = 0;
+    }
+
+    /* Give the parts to the pool if it is free */
+    if (num_parts > 1)
+    {
+        lockScanPool();
+        if (is_pool_busy == 0)
+        {
+            is_pool_busy = 1;
+            is_pooled = 1;
+            startScanWorkers(num_parts - 1);
+            pool_tasks = tasks;
+            num_pool_tasks = num_parts;
+            next_pool_task = 0;
+            num_running_tasks = num_parts;
+            signalScanCondition(&pool_work);
+            /* Scan parts on the calling thread too, then wait for the parts of the workers */
+            runPoolTasks();
+            while (num_running_tasks > 0)
+            {
+                waitScanCondition(&pool_done);
+            }
+            pool_tasks = NULL;
+            num_pool_tasks = 0;
+            next_pool_task = 0;
+            is_pool_busy = 0;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        unlockScanPool();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Scan every part on the calling thread if the pool is not used */
+    for (i = 0; (i < num_parts) && (is_pooled == 0); i++)
+    {
+        runScanTask(&tasks[i]);
+    }
+    for (i = 0; i < num_parts; i++)
+    {
+        is_complete = is_complete && tasks[i].is_complete;
+        total += parts[i].count;
+    }
+
+    /* Append the results of the parts in their order */
+    if (is_complete && (total > 0))
+    {
+        total += result->count;
+        if (total > result->capacity)
+        {
+            grown = (Student_t **)realloc(result->students, total * sizeof(Student_t *));
+            if (grown != NULL)
+            {
+                result->students = grown;
+                result->capacity = total;
+            }
+            else
+            {
+                is_complete = 0;
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        for (i = 1; (i < num_parts) && is_complete; i++)
+        {
+            memcpy(&result->students[result->count], parts[i].students, parts[i].count * sizeof(Student_t *));
+            result->count += parts[i].count;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    for (i = 1; i < num_parts; i++)
+    {
+        free(parts[i].students);
+    }
+    /* Return 1 if every matching student is appended */
+    return is_complete;
+}
+
+/**
+ * @brief Appends a student to a result set.
+ *
+ * The array of the result set doubles its capacity when it is full.
+ *
+ * @param result The result set.
+ * @param student The student to be appended.
+ * @return 1 if the student is appended, 0 if the memory of the result set cannot be allocated.
+ */
+static int32_t appendToResultSet(StudentResultSet_t *result, Student_t *student)
+{
+    Student_t **grown = NULL;           /* The grown array of the result set */
+    uint32_t capacity = 0;              /* The capacity of the grown array */
+    int32_t is_appended = 1;            /* 1 if the student is appended */
+
+    /* Grow the array when it is full */
+    if (result->count == result->capacity)
+    {
+        capacity = (result->capacity == 0) ? STUDENT_SCAN_MIN_CAPACITY : (result->capacity * 2);
+        grown = (Student_t **)realloc(result->students, capacity * sizeof(Student_t *));
+        if (grown != NULL)
+        {
+            result->students = grown;
+            result->capacity = capacity;
+        }
+        else
+        {
+            is_appended = 0;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    if (is_appended)
+    {
+        result->students[result->count] = student;
+        result->count++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* Return 1 if the student is appended */
+    return is_appended;
+}
+
+/**
+ * @brief Scans the part of a task.
+ *
+ * This function appends every matching student of the part to the result set of the task, it stops
+ * if the memory of the result set cannot be allocated.
+ *
+ * @param task The task to be run.
+ */
+static void runScanTask(ScanTask_t *task)
+{
+    uint32_t i = 0;                     /* Position of each student of the part */
+
+    for (i = 0; (i < task->count) && task->is_complete; i++)
+    {
+        if (task->match(task->students[i], task->probe))
+        {
+            task->is_complete = appendToResultSet(task->result, task->students[i]);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/**
+ * @brief Runs the tasks of the pool which are not taken yet.
+ *
+ * This function takes the tasks one by one, runs each of them without the lock of the pool and wakes
+ * the scanning thread once the last task is done.
+ *
+ * @note The calling thread holds the lock of the pool.
+ */
+static void runPoolTasks(void)
+{
+    ScanTask_t *task = NULL;            /* Each task taken by the calling thread */
+
+    while (next_pool_task < num_pool_tasks)
+    {
+        task = &pool_tasks[next_pool_task];
+        next_pool_task++;
+        unlockScanPool();
+        runScanTask(task);
+        lockScanPool();
+        num_running_tasks--;
+        if (num_running_tasks == 0)
+        {
+            signalScanCondition(&pool_done);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/**
+ * @brief Starts the worker threads of the pool which are missing.
+ *
+ * The workers are never stopped, they wait for the tasks of the next scan. A worker which cannot be started
+ * is tried again by the next scan, its tasks are taken by the other threads meanwhile.
+ *
+ * @param num_threads The number of worker threads needed.
+ * @note The calling thread holds the lock of the pool.
+ */
+static void startScanWorkers(uint32_t num_threads)
+{
+#ifdef _WIN32
+    HANDLE thread = NULL;               /* The handle of each started worker */
+#else
+    pthread_t thread;                   /* Each started worker */
+#endif
+    int32_t is_started = 1;             /* 1 while the workers are started */
+
+    while ((num_workers < num_threads) && is_started)
+    {
+#ifdef _WIN32
+        thread = CreateThread(NULL, 0, scanWorkerMain, NULL, 0, NULL);
+        is_started = (thread != NULL) ? 1 : 0;
+        if (is_started)
+        {
+            CloseHandle(thread);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+#else
+        is_started = (pthread_create(&thread, NULL, scanWorkerMain, NULL) == 0) ? 1 : 0;
+        if (is_started)
+        {
+            pthread_detach(thread);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+#endif
+        num_workers += (uint32_t)is_started;
+    }
+}
+
+/**
+ * @brief Takes the lock of the pool.
+ */
+static void lockScanPool(void)
+{
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&pool_lock);
+#else
+    pthread_mutex_lock(&pool_lock);
+#endif
+}
+
+/**
+ * @brief Releases the lock of the pool.
+ */
+static void unlockScanPool(void)
+{
+#ifdef _WIN32
+    ReleaseSRWLockExclusive(&pool_lock);
+#else
+    pthread_mutex_unlock(&pool_lock);
+#endif
+}
+
+/**
+ * @brief Releases the lock of the pool until a condition is signaled, then takes it again.
+ *
+ * The wait may end without the condition being signaled, so the caller checks its state again.
+ *
+ * @param condition The condition to be waited for.
+ */
+static void waitScanCondition(ScanCondition_t *condition)
+{
+#ifdef _WIN32
+    SleepConditionVariableSRW(condition, &pool_lock, INFINITE, 0);
+#else
+    pthread_cond_wait(condition, &pool_lock);
+#endif
+}
+
+/**
+ * @brief Wakes every thread waiting for a condition.
+ *
+ * @param condition The condition to be signaled.
+ */
+static void signalScanCondition(ScanCondition_t *condition)
+{
+#ifdef _WIN32
+    WakeAllConditionVariable(condition);
+#else
+    pthread_cond_broadcast(condition);
+#endif
+}
+
+#ifdef _WIN32
+/**
+ * @brief Runs the tasks of the pool on a worker thread.
+ *
+ * The worker waits until the pool has a task which is not taken, runs the tasks it can take and waits again.
+ *
+ * @param arg Not used.
+ * @return Never returns.
+ */
+static DWORD WINAPI scanWorkerMain(LPVOID arg)
+{
+    (void)arg;
+    lockScanPool();
+    while (1)
+    {
+        while (next_pool_task >= num_pool_tasks)
+        {
+            waitScanCondition(&pool_work);
+        }
+        runPoolTasks();
+    }
+    return 0;
+}
+#else
+/**
+ * @brief Runs the tasks of the pool on a worker thread.
+ *
+ * The worker waits until the pool has a task which is not taken, runs the tasks it can take and waits again.
+ *
+ * @param arg Not used.
+ * @return Never returns.
+ */
+static void *scanWorkerMain(void *arg)
+{
+    (void)arg;
+    lockScanPool();
+    while (1)
+    {
+        while (next_pool_task >= num_pool_tasks)
+        {
+            waitScanCondition(&pool_work);
+        }
+        runPoolTasks();
+    }
+    return NULL;
+}
+#endif /* EOF */
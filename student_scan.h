@@ -0,0 +1,80 @@
+/**
+ * @file student_scan.h
+ * @brief This file contains the function prototypes for scanning the students of the list.
+ *
+ * This file contains the function prototypes of a scan which keeps the students matching a probe
+ * in a result set, in the order of the list. A chain of students is scanned on the calling thread,
+ * while an array of students in the order of the list may be cut into parts scanned on a pool of threads,
+ * whose results are then appended one after the other.
+ *
+ * @author Viet Ha Nguyen
+ * @date 10/16/2026
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+#include <stdint.h>             /* Include standard integer types library for fixed-width integers like int8_t, uint64_t, etc. */
+#include <stdlib.h>             /* For realloc(), free() functions */
+#include <string.h>             /* For memcpy() function */
+#include "manage_students.h"    /* Include header file for the Student_t and StudentResultSet_t structures */
+
+/*******************************************************************************
+ * Header guards
+ ******************************************************************************/
+#ifndef STUDENT_SCAN_H
+#define STUDENT_SCAN_H
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define STUDENT_SCAN_MAX_THREADS    64          /* The maximum number of threads of a parallel scan */
+#define STUDENT_SCAN_MIN_PART       65536u      /* The minimum number of students scanned by each thread */
+#define STUDENT_SCAN_MIN_CAPACITY   16u         /* The number of students of a result set when it is first allocated */
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+/**
+ * @brief Pointer to a function which checks if a student matches a probe.
+ *
+ * The function returns 1 if the student matches, 0 otherwise. It is called on several threads at the same
+ * time by a parallel scan, so it must not change anything nor call the functions of the list.
+ */
+typedef int32_t (*StudentMatch_t)(const Student_t *student, const Student_t *probe);
+
+/*******************************************************************************
+ * Prototype
+ ******************************************************************************/
+/**
+ * @brief Scans a chain of students on the calling thread.
+ *
+ * @param first The first student of the chain, NULL for an empty chain.
+ * @param match The function which checks each student.
+ * @param probe The student which the students are matched with.
+ * @param result The result set, the matching students are appended to it.
+ * @return 1 if every matching student is appended, 0 if the memory of the result set cannot be allocated.
+ */
+int32_t scanStudentChain(Student_t *first, StudentMatch_t match, const Student_t *probe, StudentResultSet_t *result);
+
+/**
+ * @brief Scans an array of students on several threads.
+ *
+ * This function cuts the array into one part per thread, each part having at least STUDENT_SCAN_MIN_PART
+ * students, and scans the parts at the same time on the calling thread and on worker threads which are kept
+ * for the next scans. Each part keeps its matching students in its own result set, so the threads never share
+ * memory they write, and the results are appended to the result set in the order of the parts.
+ * The workers run one scan at a time, the parts of a scan started meanwhile are scanned on the calling thread.
+ *
+ * @param students The students in the order of the list.
+ * @param count The number of students.
+ * @param match The function which checks each student.
+ * @param probe The student which the students are matched with.
+ * @param num_threads The number of threads, between 1 and STUDENT_SCAN_MAX_THREADS.
+ * @param result The result set, the matching students are appended to it.
+ * @return 1 if every matching student is appended, 0 if the memory of the result set cannot be allocated.
+ */
+int32_t scanStudentArray(Student_t *const *students, uint32_t count, StudentMatch_t match, const Student_t *probe,
+                         int32_t num_threads, StudentResultSet_t *result);
+
+#endif /* STUDENT_SCAN_H */